@@ -0,0 +1,63 @@
+#ifndef ASYNC_EVALUATOR_H_
+#define ASYNC_EVALUATOR_H_
+
+#include "types.h"
+#include "evaluation.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+/**
+ * Runs evaluations on a background thread, so the render loop never waits
+ * for one.
+ *
+ * Starting an evaluation cancels the one in progress. Monte Carlo runs are
+ * simulated in batches, and the estimate is published after every batch so
+ * the displayed equity refines while the simulation goes on. Batches are
+ * shards of a single run, so the final estimate is the same as
+ * `Evaluator::evaluate`'s.
+ */
+class AsyncEvaluator {
+  public:
+    struct Progress {
+      EvalResult result;
+      size_t simulations;
+      bool done;
+    };
+
+    explicit AsyncEvaluator(size_t numSimulations = 100000);
+    ~AsyncEvaluator();
+
+    AsyncEvaluator(const AsyncEvaluator&) = delete;
+    AsyncEvaluator& operator=(const AsyncEvaluator&) = delete;
+
+    void start(const Situation& situation);
+    void cancel();
+
+    // Latest estimate of the current evaluation, if it changed since the last call
+    std::optional<Progress> poll();
+
+  private:
+    static constexpr size_t BATCH_SIZE = 5000;
+
+    void run();
+
+    Evaluator evaluator_;
+    size_t numSimulations_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::optional<Situation> pending_;
+    std::optional<Progress> progress_;
+    std::atomic<uint64_t> generation_{0};
+    bool stop_{false};
+
+    // Started last, once the state above is constructed
+    std::thread worker_;
+};
+
+#endif // ASYNC_EVALUATOR_H_
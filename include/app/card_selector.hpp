@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "app/card.hpp"
+#include <bitset>
 #include <optional>
 #include <vector>
 
@@ -17,9 +18,20 @@ class CardSelector {
     void reset();
 
   private:
+    // Row-major position of a card in the grid: hearts, diamonds, clubs, spades
+    static int gridIndex(const Card& card);
+    sf::Vector2f cardPosition(int index) const;
+    void updateHighlights();
+
     sf::Vector2f position_;
     sf::Vector2f cardSize_;
-    std::vector<int> selectedCards_;
+    std::bitset<52> selectedCards_;
+
+    // The grid never changes, so its geometry is built once; highlights are
+    // rebuilt when the selection changes
+    sf::VertexArray grid_;
+    std::vector<sf::Text> labels_;
+    sf::VertexArray highlights_;
 };
 
 #endif // CARD_SELECTOR_H_
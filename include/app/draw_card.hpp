@@ -2,8 +2,18 @@
 #define DRAW_CARD_H_
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include "app/card.hpp"
 
+// Font shared by the widgets, loaded on first use
+const sf::Font& appFont();
+
+// Rank and suit labels of a card whose face is at position/size
+std::array<sf::Text, 2> cardLabels(const Card& card, const sf::Vector2f& position, const sf::Vector2f& size);
+
+// Appends a filled rectangle, as two triangles, to a vertex array
+void appendRect(sf::VertexArray& vertices, const sf::Vector2f& position, const sf::Vector2f& size, sf::Color color);
+
 // Draws a single card (rank/suit) into a render target
 void drawCard(const Card& card,
               sf::RenderTarget& rt,
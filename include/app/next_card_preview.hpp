@@ -0,0 +1,56 @@
+#ifndef NEXT_CARD_PREVIEW_H_
+#define NEXT_CARD_PREVIEW_H_
+
+#include "types.h"
+#include "evaluation.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+/**
+ * Equity of the hands for every card that can come next on the board,
+ * computed in the background so that hovering a card shows it at once.
+ *
+ * On a flop or a turn, each next card leaves at most 44 runouts to
+ * enumerate, so the whole deck is ready shortly after `start`. A card asked
+ * for with `get` before its turn is computed next.
+ */
+class NextCardPreview {
+  public:
+    NextCardPreview();
+    ~NextCardPreview();
+
+    NextCardPreview(const NextCardPreview&) = delete;
+    NextCardPreview& operator=(const NextCardPreview&) = delete;
+
+    // The board of `situation` must hold a flop or a turn
+    void start(const Situation& situation);
+    void cancel();
+
+    // Equity once `card` (an engine card) is dealt, if already computed
+    std::optional<EvalResult> get(uint32_t card);
+
+  private:
+    void run();
+
+    Evaluator evaluator_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::optional<Situation> pending_;
+    std::array<std::optional<EvalResult>, 52> results_;
+    std::optional<CardIndex> requested_;
+    std::atomic<uint64_t> generation_{0};
+    bool stop_{false};
+
+    // Started last, once the state above is constructed
+    std::thread worker_;
+};
+
+#endif // NEXT_CARD_PREVIEW_H_
@@ -0,0 +1,65 @@
+#ifndef RANGE_EQUITY_WORKER_H_
+#define RANGE_EQUITY_WORKER_H_
+
+#include "hand_range.hpp"
+#include "range_evaluation.hpp"
+#include "app/range_grid.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/**
+ * Keeps the totals of every starting combo against a villain range up to
+ * date on a background thread.
+ *
+ * Totals are computed for all 1326 combos, so changing the hero range needs
+ * no evaluation at all. Totals are also linear in the villain weights: when
+ * a villain cell changes weight, only the totals against that cell's combos
+ * are computed, scaled by the change and added. The board changing starts
+ * over from scratch.
+ */
+class RangeEquityWorker {
+  public:
+    RangeEquityWorker();
+    ~RangeEquityWorker();
+
+    RangeEquityWorker(const RangeEquityWorker&) = delete;
+    RangeEquityWorker& operator=(const RangeEquityWorker&) = delete;
+
+    // Board of 3 to 5 engine cards; with fewer cards nothing is evaluated
+    void setBoard(const std::vector<uint32_t>& board);
+    void setVillainWeight(int cell, float weight);
+    void reset();
+
+    // Totals in the order of `combos()`, if they changed since the last call
+    std::optional<std::vector<ComboTotals>> poll();
+    bool busy() const { return busy_; }
+
+    // Every starting combo, with weight 1
+    static const HandRange& combos();
+
+  private:
+    void run();
+
+    RangeEvaluator evaluator_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::vector<uint32_t> board_;
+    bool boardChanged_{false};
+    std::array<float, RangeGrid::NUM_CELLS> villainWeights_{};
+    std::optional<std::vector<ComboTotals>> published_;
+    std::atomic<bool> busy_{false};
+    bool stop_{false};
+
+    // Started last, once the state above is constructed
+    std::thread worker_;
+};
+
+#endif // RANGE_EQUITY_WORKER_H_
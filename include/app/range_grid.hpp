@@ -0,0 +1,52 @@
+#ifndef RANGE_GRID_H_
+#define RANGE_GRID_H_
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * 13x13 starting hand grid: pairs on the diagonal, suited hands above it and
+ * offsuit hands below, aces first. Each cell holds a weight, and optionally
+ * an equity that colors it as a heatmap.
+ */
+class RangeGrid {
+  public:
+    static constexpr int NUM_CELLS = 169;
+
+    RangeGrid(const sf::Vector2f& position, float cellSize);
+
+    void draw(sf::RenderTarget& rt) const;
+    std::optional<int> getClickedCell(const sf::Vector2i& mousePos) const;
+
+    float weight(int cell) const { return weights_[cell]; }
+    void setWeight(int cell, float weight);
+
+    void setEquities(const std::array<std::optional<float>, NUM_CELLS>& equities);
+    void clearEquities();
+    void reset();
+
+    // Cell of a combo of engine cards, and the name of a cell ("AKs")
+    static int cellOf(uint32_t card1, uint32_t card2);
+    static std::string cellName(int cell);
+
+    // Engine cards of the 6, 4 or 12 combos of a cell
+    static std::vector<std::pair<uint32_t, uint32_t>> cellCombos(int cell);
+
+  private:
+    void updateCells();
+
+    sf::Vector2f position_;
+    float cellSize_;
+    std::array<float, NUM_CELLS> weights_{};
+    std::array<std::optional<float>, NUM_CELLS> equities_{};
+
+    sf::VertexArray cells_;
+    std::vector<sf::Text> labels_;
+};
+
+#endif // RANGE_GRID_H_
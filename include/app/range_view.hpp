@@ -0,0 +1,53 @@
+#ifndef RANGE_VIEW_H_
+#define RANGE_VIEW_H_
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+#include "app/card.hpp"
+#include "app/cards_display.hpp"
+#include "app/range_equity_worker.hpp"
+#include "app/range_grid.hpp"
+
+/**
+ * Range-vs-range mode: a starting hand grid per player and a board. The hero
+ * grid doubles as a heatmap of each hand's equity against the villain range.
+ *
+ * Clicking a cell toggles it, and the mouse wheel changes its weight by
+ * steps of 25%.
+ */
+class RangeView {
+  public:
+    explicit RangeView(const sf::Font& font);
+
+    // Return true when the click or scroll changed a range
+    bool handleClick(const sf::Vector2i& mousePos);
+    bool handleScroll(const sf::Vector2i& mousePos, float delta);
+
+    bool boardFull() const { return board_.size() == 5; }
+    void addBoardCard(const Card& card);
+
+    // Pick up new totals; return true when there is something new to draw
+    bool update();
+    bool busy() const { return worker_.busy(); }
+
+    void draw(sf::RenderTarget& rt) const;
+    void reset();
+
+  private:
+    void setWeight(RangeGrid& grid, int cell, float weight);
+    void updateEquities();
+
+    RangeGrid hero_;
+    RangeGrid villain_;
+    Board board_;
+    RangeEquityWorker worker_;
+
+    // Totals of every combo of RangeEquityWorker::combos(), and their cells
+    std::vector<ComboTotals> totals_;
+    std::vector<int> comboCells_;
+
+    sf::Text text_;
+};
+
+#endif // RANGE_VIEW_H_
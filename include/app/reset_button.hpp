@@ -13,6 +13,8 @@ class ResetButton {
   private:
     sf::Vector2f position_;
     sf::Vector2f size_;
+    sf::RectangleShape button_;
+    sf::Text text_;
 };
 
 #endif // RESET_BUTTON_H_
@@ -1,11 +1,20 @@
 #ifndef BITSET_RANKINDEX_H_
 #define BITSET_RANKINDEX_H_
 
+#include "table_buffer.h"
+
 #include <bit>
 #include <cstdint>
 #include <array>
 #include <vector>
 
+/**
+ * Maps each of a set of keys to its rank among them.
+ *
+ * Each 64-bit word of the membership bitset is stored next to the number of
+ * keys before it, in a 16-byte entry that never straddles a cache line, so a
+ * lookup costs a single cache line fetch.
+ */
 class BitsetRankIndex {
 public:
   BitsetRankIndex(uint32_t max_value, const std::vector<uint32_t>& keys);
@@ -14,9 +23,22 @@ public:
   uint32_t size() const;
 
 private:
-  std::vector<uint64_t> bits_;
-  std::vector<uint32_t> prefix_;
+  struct alignas(16) Entry {
+    uint64_t bits;
+    uint32_t prefix;  // keys before this word
+  };
+
+  const Entry* entries() const { return storage_.as<Entry>(); }
+
+  TableBuffer storage_;
+  size_t words_{0};
   uint32_t n_{0};
 };
 
+inline uint32_t BitsetRankIndex::operator()(uint32_t k) const {
+  const Entry& entry = entries()[k >> 6];
+  uint64_t mask = (uint64_t(1) << (k & 63)) - 1;
+  return entry.prefix + std::popcount(entry.bits & mask);
+}
+
 #endif // BITSET_RANKINDEX_H_
@@ -0,0 +1,59 @@
+#ifndef BOARD_CLASSES_H_
+#define BOARD_CLASSES_H_
+
+#include "static_vector.h"
+#include "card_index.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Suit-isomorphism classes of the boards of one street.
+ *
+ * Permuting the suits of a board and of every hand dealt with it changes
+ * nothing, so boards only need to be considered up to a suit permutation:
+ * this leaves 1755 flops, 16432 turns and 134459 rivers. The representative
+ * of a class is its board of smallest position in colex order, and classes
+ * are numbered in the order of their representatives. `FlopDatabase` numbers
+ * its flops with these classes.
+ */
+class BoardClasses {
+public:
+  using SuitPermutation = std::array<uint8_t, 4>;
+  using Board = StaticVector<uint32_t, 5>;
+
+  struct Canonical {
+    size_t index;           // class of the board
+    SuitPermutation suits;  // suit permutation taking the board to its representative
+  };
+
+  /**
+   * Classes of the boards of 3, 4 or 5 cards, built on first use (about
+   * 0.2s for the rivers).
+   */
+  static const BoardClasses& of(size_t board_size);
+
+  size_t board_size() const { return m_board_size; }
+  size_t size() const { return m_keys.size(); }
+
+  // Representative of class `index`, in increasing card index order
+  Board board(size_t index) const;
+
+  Canonical classify(const Board& board) const;
+
+  static uint32_t permute(uint32_t card, const SuitPermutation& suits) {
+    CardIndex index = card_index(card);
+    return card_at(suits[index / 13] * 13 + index % 13);
+  }
+
+private:
+  explicit BoardClasses(size_t board_size);
+
+  size_t m_board_size;
+  std::vector<uint32_t> m_keys;                       // colex positions of the representatives
+  std::vector<std::array<CardIndex, 5>> m_boards;     // the representatives
+};
+
+#endif // BOARD_CLASSES_H_
@@ -0,0 +1,110 @@
+#ifndef BUCKET_TABLE_H_
+#define BUCKET_TABLE_H_
+
+#include "board_classes.hpp"
+#include "hand_range.hpp"
+#include "table_buffer.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Card abstraction: every hole-card combo on every flop, turn and river,
+ * mapped to a bucket of hands of similar strength.
+ *
+ * A combo is described by its equity against a reference range: on the
+ * river, the equity itself; on the flop and the turn, the distribution of
+ * its final equity over the runouts, as a cumulative histogram. The combos
+ * of a sample of boards are clustered with k-means (so that the Euclidean
+ * distance between cumulative histograms stands in for the earth mover's
+ * distance between distributions), and buckets are numbered from the
+ * weakest cluster to the strongest. Every board is then bucketed against
+ * the clusters and streamed to the file.
+ *
+ * The file holds one byte per combo (1326, in colex order of card indices)
+ * for each board class of `BoardClasses`, street after street, behind a
+ * header. It is memory-mapped for lookups.
+ */
+class BucketTable {
+public:
+  static constexpr size_t NUM_COMBOS = 1326;
+  // Byte of the combos sharing a card with the board
+  static constexpr uint8_t BLOCKED = 0xff;
+
+  struct GenerateOptions {
+    size_t num_buckets{50};      // per street, at most 254
+    size_t num_bins{20};         // histogram bins on the flop and the turn
+    size_t sample_boards{200};   // boards per street sampled to fit the clusters
+    size_t iterations{30};       // k-means iterations, at most
+    size_t max_boards{SIZE_MAX}; // boards per street written, the first classes
+    size_t num_threads{1};
+    uint64_t seed{0x5eed};
+
+    // Empty for every combo with weight 1. The table only holds one board per
+    // suit-isomorphism class, so permuting the suits must leave the weights
+    // unchanged: e.g. all six AA combos, not As Ah alone
+    HandRange range;
+
+    // Called after each chunk of boards written, from the calling thread
+    std::function<void(size_t board_size, size_t done, size_t total)> progress;
+  };
+
+  /**
+   * Cluster and write every board to `path`. Only a chunk of boards is in
+   * memory at any time. Throws std::invalid_argument for invalid options,
+   * including a range that is not suit-symmetric, and std::runtime_error on
+   * I/O errors.
+   */
+  static void generate(const std::string& path, const GenerateOptions& options);
+
+  /**
+   * Map a table written by `generate`. Throws std::runtime_error if the file
+   * cannot be mapped or is not a bucket table.
+   */
+  static BucketTable load(const std::string& path);
+
+  /**
+   * Features of every combo on a board of 3 to 5 cards against `range`,
+   * `num_bins` values per combo on the flop and the turn (the share of the
+   * runouts ending with at most the upper equity of each bin) and one on the
+   * river (the equity). `valid[c]` tells whether combo c holds features: it
+   * does not when it shares a card with the board or no combo of the range
+   * is left to face it.
+   */
+  static void features(const BoardClasses::Board& board, const HandRange& range, size_t num_bins,
+                       std::vector<float>& features, std::vector<bool>& valid);
+
+  // Index of a combo of two distinct card indices
+  static size_t combo_index(CardIndex first, CardIndex second) {
+    if (first > second) std::swap(first, second);
+    return second * (second - 1) / 2 + first;
+  }
+
+  size_t num_buckets() const { return m_num_buckets; }
+
+  // Boards of `board_size` cards in the table: the first classes of the street
+  size_t num_boards(size_t board_size) const { return m_num_boards[board_size - 3]; }
+
+  /**
+   * Bucket of `hole` on `board`, or nothing when the table does not hold the
+   * board or the reference range left the combo without features (no combo
+   * to face it). The hole cards must not be on the board.
+   */
+  std::optional<uint8_t> bucket(const std::array<uint32_t, 2>& hole, const BoardClasses::Board& board) const;
+
+private:
+  BucketTable() = default;
+
+  MappedFile m_file;
+  size_t m_num_buckets{0};
+  std::array<size_t, 3> m_num_boards{};
+  std::array<const uint8_t*, 3> m_streets{};
+};
+
+#endif // BUCKET_TABLE_H_
@@ -0,0 +1,64 @@
+#ifndef CARD_INDEX_H_
+#define CARD_INDEX_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Compact card encoding: one byte per card, 0..51, in `initialize_deck()`
+ * order, i.e. suit (spades, hearts, diamonds, clubs) * 13 + rank
+ * (deuce=0, ..., ace=12).
+ *
+ * Both directions of the conversion with the Cactus-Kev words are single
+ * table lookups. The reverse table is indexed by the rank and suit nibbles
+ * (bits 8..15) of the Cactus-Kev word.
+ */
+using CardIndex = uint8_t;
+
+constexpr std::array<uint32_t, 52> CARD_FROM_INDEX = [] {
+  constexpr std::array<uint32_t, 13> primes = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41};
+  std::array<uint32_t, 52> cards{};
+  for (uint32_t index = 0; index < 52; ++index) {
+    uint32_t rank = index % 13;
+    uint32_t suit = 1u << (index / 13);
+    cards[index] = primes[rank] | (rank << 8) | (suit << 12) | (1u << (16 + rank));
+  }
+  return cards;
+}();
+
+constexpr std::array<CardIndex, 256> INDEX_FROM_CARD = [] {
+  std::array<CardIndex, 256> indices{};
+  for (CardIndex index = 0; index < 52; ++index) {
+    indices[(CARD_FROM_INDEX[index] >> 8) & 0xff] = index;
+  }
+  return indices;
+}();
+
+constexpr CardIndex card_index(uint32_t card) {
+  return INDEX_FROM_CARD[(card >> 8) & 0xff];
+}
+
+constexpr uint32_t card_at(int index) {
+  return CARD_FROM_INDEX[index];
+}
+
+template <std::size_t N>
+constexpr std::array<CardIndex, N> to_indices(const std::array<uint32_t, N>& cards) {
+  std::array<CardIndex, N> indices{};
+  for (std::size_t i = 0; i < N; ++i) {
+    indices[i] = card_index(cards[i]);
+  }
+  return indices;
+}
+
+template <std::size_t N>
+constexpr std::array<uint32_t, N> to_cards(const std::array<CardIndex, N>& indices) {
+  std::array<uint32_t, N> cards{};
+  for (std::size_t i = 0; i < N; ++i) {
+    cards[i] = card_at(indices[i]);
+  }
+  return cards;
+}
+
+#endif // CARD_INDEX_H_
@@ -0,0 +1,58 @@
+#ifndef CARD_SET_H_
+#define CARD_SET_H_
+
+#include "card_index.h"
+
+#include <bit>
+#include <cstdint>
+
+/**
+ * Set of cards stored as a 52-bit mask indexed by `card_index`.
+ */
+class CardSet {
+public:
+  constexpr CardSet() = default;
+  constexpr explicit CardSet(uint64_t bits) : m_bits{bits & FULL} {}
+
+  template <typename InputIterator>
+  constexpr CardSet(InputIterator begin, InputIterator end) {
+    for (auto it = begin; it != end; ++it) {
+      insert(*it);
+    }
+  }
+
+  static constexpr CardSet full() { return CardSet{FULL}; }
+
+  constexpr bool contains(uint32_t card) const { return (m_bits >> card_index(card)) & 1; }
+  constexpr void insert(uint32_t card) { m_bits |= uint64_t(1) << card_index(card); }
+  constexpr void erase(uint32_t card) { m_bits &= ~(uint64_t(1) << card_index(card)); }
+
+  constexpr bool intersects(CardSet other) const { return m_bits & other.m_bits; }
+  constexpr int size() const { return std::popcount(m_bits); }
+  constexpr bool empty() const { return m_bits == 0; }
+  constexpr uint64_t bits() const { return m_bits; }
+
+  constexpr CardSet operator|(CardSet other) const { return CardSet{m_bits | other.m_bits}; }
+  constexpr CardSet operator&(CardSet other) const { return CardSet{m_bits & other.m_bits}; }
+  constexpr CardSet operator-(CardSet other) const { return CardSet{m_bits & ~other.m_bits}; }
+  constexpr CardSet& operator|=(CardSet other) { m_bits |= other.m_bits; return *this; }
+  constexpr CardSet& operator-=(CardSet other) { m_bits &= ~other.m_bits; return *this; }
+  constexpr bool operator==(const CardSet&) const = default;
+
+  /**
+   * Call f with every card of the set, as Cactus-Kev words, in deck order.
+   */
+  template <typename F>
+  constexpr void for_each(F&& f) const {
+    for (uint64_t bits = m_bits; bits; bits &= bits - 1) {
+      f(card_at(std::countr_zero(bits)));
+    }
+  }
+
+private:
+  static constexpr uint64_t FULL = (uint64_t(1) << 52) - 1;
+
+  uint64_t m_bits{0};
+};
+
+#endif // CARD_SET_H_
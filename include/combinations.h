@@ -0,0 +1,142 @@
+#ifndef COMBINATIONS_H_
+#define COMBINATIONS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+constexpr uint64_t binomial(unsigned n, unsigned k) {
+  if (k > n) return 0;
+  uint64_t result = 1;
+  for (unsigned i = 1; i <= k; ++i) {
+    result = result * (n - k + i) / i;
+  }
+  return result;
+}
+
+/**
+ * binomial(n, k) for the card indices (n up to 52) and up to 7 cards.
+ */
+constexpr auto BINOMIALS = [] {
+  std::array<std::array<uint32_t, 8>, 53> table{};
+  for (unsigned n = 0; n < table.size(); ++n) {
+    for (unsigned k = 0; k < table[n].size(); ++k) {
+      table[n][k] = static_cast<uint32_t>(binomial(n, k));
+    }
+  }
+  return table;
+}();
+
+/**
+ * Combinations of K elements of {0, ..., n - 1}, in colexicographic order:
+ * by largest element, then by second largest, and so on.
+ *
+ * The rank of {c_0 < ... < c_{K-1}} is the sum of binomial(c_i, i + 1). It
+ * does not depend on n, so the combinations of the first n elements are
+ * exactly the ranks below binomial(n, K). Stepping to the next combination
+ * only changes its smallest elements, which lets enumerations keep the work
+ * done on the larger ones (see `fold_combinations`).
+ */
+template <size_t K>
+struct Combinations {
+  using Combination = std::array<uint8_t, K>;
+
+  static constexpr uint64_t rank(const Combination& c) {
+    uint64_t r = 0;
+    for (size_t i = 0; i < K; ++i) {
+      if constexpr (K < BINOMIALS[0].size()) {
+        if (c[i] < BINOMIALS.size()) {
+          r += BINOMIALS[c[i]][i + 1];
+          continue;
+        }
+      }
+      r += binomial(c[i], static_cast<unsigned>(i + 1));
+    }
+    return r;
+  }
+
+  static constexpr Combination unrank(uint64_t r) {
+    Combination c{};
+    for (size_t i = K; i-- > 0;) {
+      // Largest element whose binomial still fits in r
+      unsigned x = static_cast<unsigned>(i);
+      while (binomial(x + 1, static_cast<unsigned>(i + 1)) <= r) {
+        ++x;
+      }
+      c[i] = static_cast<uint8_t>(x);
+      r -= binomial(x, static_cast<unsigned>(i + 1));
+    }
+    return c;
+  }
+
+  static constexpr Combination first() {
+    Combination c{};
+    for (size_t i = 0; i < K; ++i) {
+      c[i] = static_cast<uint8_t>(i);
+    }
+    return c;
+  }
+
+  /**
+   * Step `c` to the next combination and return the index of the largest
+   * element that changed: elements above it are left as they were.
+   */
+  static constexpr size_t next(Combination& c) {
+    size_t i = 0;
+    while (i + 1 < K && c[i] + 1 == c[i + 1]) {
+      ++i;
+    }
+    ++c[i];
+    for (size_t j = 0; j < i; ++j) {
+      c[j] = static_cast<uint8_t>(j);
+    }
+    return i;
+  }
+
+  /**
+   * All the combinations of N elements, in order.
+   */
+  template <unsigned N>
+  static constexpr std::array<Combination, binomial(N, K)> all() {
+    std::array<Combination, binomial(N, K)> table{};
+    Combination c = first();
+    for (auto& entry : table) {
+      entry = c;
+      next(c);
+    }
+    return table;
+  }
+};
+
+/**
+ * Call f(c, state) for the combinations of ranks `begin` to `end` - 1, where
+ * `state` folds `add(state, element)` over the elements of `c` from the
+ * largest down, starting from `initial`.
+ *
+ * The partial folds of the elements that consecutive combinations share are
+ * kept, so, for instance, dealing the turn and river pairs of a flop adds
+ * each turn card once rather than once per river.
+ */
+template <size_t K, typename State, typename Add, typename F>
+constexpr void fold_combinations(uint64_t begin, uint64_t end, const State& initial, Add&& add, F&& f) {
+  if (begin >= end) return;
+
+  auto c = Combinations<K>::unrank(begin);
+
+  // partial[i] folds the elements c[K - 1] down to c[i]
+  std::array<State, K + 1> partial{};
+  partial[K] = initial;
+  for (size_t i = K; i-- > 0;) {
+    partial[i] = add(partial[i + 1], c[i]);
+  }
+
+  for (uint64_t r = begin;;) {
+    f(c, partial[0]);
+    if (++r == end) break;
+    for (size_t i = Combinations<K>::next(c) + 1; i-- > 0;) {
+      partial[i] = add(partial[i + 1], c[i]);
+    }
+  }
+}
+
+#endif // COMBINATIONS_H_
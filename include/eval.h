@@ -6,6 +6,9 @@
 #include <cstdint>
 
 #include "tables.h"
+#include "combinations.h"
+#include "card_index.h"
+#include "stats.h"
 
 /**
  * bit scheme for a card:
@@ -29,49 +32,51 @@ inline bool is_flush(const std::array<uint32_t, 5>& hand) {
 
 template <typename HashFunc>
 uint16_t eval5(const HashFunc& hash, const std::array<uint32_t, 5>& hand) {
-  int idx = q(hand);
+  STATS_ADD(EVAL5, 1);
+  const Eval5Entry& entry = eval5_table[q(hand)];
 
   // Check for flushes and straight flushes
   if (is_flush(hand)) {
-    return flush_table[idx];
+    STATS_ADD(FLUSH, 1);
+    return entry.flush;
   }
 
   // Check for Straights and High card hands.
   uint16_t s;
-  if ((s = unique5[idx])) {
+  if ((s = entry.unique)) {
+    STATS_ADD(UNIQUE5, 1);
     return s;
   }
 
   // Perfect hash lookup for remaining hands
-  idx = (hand[0] & 0xff) * (hand[1] & 0xff) * (hand[2] & 0xff) * (hand[3] & 0xff) * (hand[4] & 0xff);
+  STATS_ADD(HASH, 1);
+  int idx = (hand[0] & 0xff) * (hand[1] & 0xff) * (hand[2] & 0xff) * (hand[3] & 0xff) * (hand[4] & 0xff);
   return VALUES[hash(idx)];
 }
 
+template <typename HashFunc>
+uint16_t eval6(const HashFunc& hash, const std::array<uint32_t, 6>& hand) {
+  std::array<uint32_t, 5> hand5;
+  uint16_t best = 7462; // worst possible hand value: 7-5-4-3-2 offsuit
+  for (size_t skip = 0; skip < 6; ++skip) {
+    for (size_t i = 0, j = 0; i < 6; ++i) {
+      if (i != skip) {
+        hand5[j++] = hand[i];
+      }
+    }
+    auto score = eval5(hash, hand5);
+    if (score < best) {
+      best = score;
+    }
+  }
+  return best;
+}
+
 template <typename HashFunc>
 uint16_t eval7(const HashFunc& hash, const std::array<uint32_t, 7>& hand) {
-  std::array<std::array<int, 5>, 21> combs {
-    std::array<int, 5>{0, 1, 2, 3, 4},
-    {0, 1, 2, 3, 5},
-    {0, 1, 2, 3, 6},
-    {0, 1, 2, 4, 5},
-    {0, 1, 2, 4, 6},
-    {0, 1, 2, 5, 6},
-    {0, 1, 3, 4, 5},
-    {0, 1, 3, 4, 6},
-    {0, 1, 3, 5, 6},
-    {0, 1, 4, 5, 6},
-    {0, 2, 3, 4, 5},
-    {0, 2, 3, 4, 6},
-    {0, 2, 3, 5, 6},
-    {0, 2, 4, 5, 6},
-    {0, 3, 4, 5, 6},
-    {1, 2, 3, 4, 5},
-    {1, 2, 3, 4, 6},
-    {1, 2, 3, 5, 6},
-    {1, 2, 4, 5, 6},
-    {1, 3, 4, 5, 6},
-    {2, 3, 4, 5, 6}
-  };
+  STATS_ADD(EVAL7, 1);
+  // The 21 ways of picking 5 of the 7 cards
+  static constexpr auto combs = Combinations<5>::all<7>();
 
   std::array<uint32_t, 5> hand5;
   uint16_t best = 7462; // worst possible hand value: 7-5-4-3-2 offsuit
@@ -87,4 +92,12 @@ uint16_t eval7(const HashFunc& hash, const std::array<uint32_t, 7>& hand) {
   return best;
 }
 
+/**
+ * Same as above for a hand given as compact card indices.
+ */
+template <typename HashFunc>
+uint16_t eval7(const HashFunc& hash, const std::array<CardIndex, 7>& hand) {
+  return eval7(hash, to_cards(hand));
+}
+
 #endif // EVAL_H_
@@ -2,22 +2,148 @@
 #define EVALUATION_H_
 
 #include "types.h"
+#include "static_vector.h"
+#include "card_index.h"
+#include "card_set.h"
+#include "hand_range.hpp"
 
 #include <array>
+#include <memory>
 #include <vector>
 #include <cstdint>
 #include <iterator>
 #include <cassert>
+#include <utility>
 
 
+class StateTable;
+class FlopDatabase;
+class ThreadPool;
+
+/**
+ * The cards known to a query: each player's hole cards, the board so far,
+ * and dead cards (mucked or exposed) that cannot come on the board.
+ */
+struct Situation {
+  StaticVector<std::array<uint32_t, 2>, MAX_PLAYERS> hands;
+  StaticVector<uint32_t, 5> board;
+  CardSet dead;
+};
+
+/**
+ * Working memory of a query.
+ *
+ * Hands and the dead-card deck are stored inline; only the rank buffer lives
+ * on the heap, and it is only ever grown. Once a scratch has served the
+ * largest query of a workload, further queries do not allocate.
+ */
+struct EvalScratch {
+  StaticVector<std::array<uint32_t, 7>, MAX_PLAYERS> hands;
+  StaticVector<uint32_t, 52> deck;
+  std::vector<uint16_t> results;
+};
+
+/**
+ * Equity calculator for a fixed set of hole cards and a (partial) board.
+ *
+ * The const query methods taking a `Situation` only read the evaluator's
+ * configuration and the shared lookup tables, and work in an `EvalScratch`:
+ * either one given by the caller or one owned by the calling thread. One
+ * evaluator can therefore serve many threads at once, and repeated queries
+ * run without heap allocations. The setters are not synchronized and must
+ * not race with queries.
+ */
 class Evaluator {
 public:
-  Evaluator();
+  static constexpr uint64_t DEFAULT_SEED = 0x5eed;
+
+  // Hands ranked by an enumeration, below which waking up a pool costs more
+  // than it saves
+  static constexpr size_t DEFAULT_PARALLEL_THRESHOLD = 4096;
+
+  explicit Evaluator(uint64_t seed = DEFAULT_SEED);
+
+  /**
+   * Seed the Monte Carlo sampling.
+   *
+   * Simulation i draws its cards from its own Philox stream, so results only
+   * depend on the seed and the simulation index.
+   */
+  void set_seed(uint64_t seed) { m_seed = seed; }
+  uint64_t seed() const { return m_seed; }
+
+  void set_num_simulations(size_t num_simulations) { m_num_simulations = num_simulations; }
+
+  /**
+   * Choose how 7-card hands are ranked: with the compact `SplitEvaluator`
+   * tables (the default, when `table` is null), or with a state transition
+   * table. Both give the same ranks as `eval7`.
+   */
+  void set_state_table(std::shared_ptr<const StateTable> table) { m_state_table = std::move(table); }
+  const StateTable* state_table() const { return m_state_table.get(); }
+
+  /**
+   * Spread the exhaustive enumerations of flops and turns over `pool` when
+   * they rank at least `threshold` hands (runouts times players), and the
+   * counting of outcomes in `evaluate` likewise. Smaller ones, Monte Carlo
+   * sampling, and every query without a pool run on the calling thread. The
+   * results are identical either way.
+   */
+  void set_thread_pool(std::shared_ptr<ThreadPool> pool, size_t threshold = DEFAULT_PARALLEL_THRESHOLD) {
+    m_thread_pool = std::move(pool);
+    m_parallel_threshold = threshold;
+  }
+  ThreadPool* thread_pool() const { return m_thread_pool.get(); }
+
+  /**
+   * Answer heads-up flop queries of `evaluate` without dead cards from a
+   * precomputed database when it holds the flop, instead of enumerating the
+   * runouts. The results are the same.
+   */
+  void set_flop_database(std::shared_ptr<const FlopDatabase> database) { m_flop_database = std::move(database); }
+  const FlopDatabase* flop_database() const { return m_flop_database.get(); }
+
+  /**
+   * Answer preflop queries of `evaluate_vs_random` for a single hand without
+   * dead cards from the precomputed tables of `preflop_tables.h` (the
+   * default), instead of sampling.
+   */
+  void set_preflop_tables(bool enabled) { m_preflop_tables = enabled; }
+  bool preflop_tables() const { return m_preflop_tables; }
 
   /**
    * Return a `Result` sruct with win and tie probabilities for the first hand.
+   * Throws std::invalid_argument if the situation holds fewer than two hands
+   * (see `evaluate_vs_random` to play a single hand).
    */
-  EvalResult evaluate();
+  EvalResult evaluate(const Situation& situation) const;
+  EvalResult evaluate(const Situation& situation, EvalScratch& scratch) const;
+
+  /**
+   * Win and tie probabilities of the first hand against the other hands and
+   * `num_opponents` more players dealt random hole cards.
+   *
+   * Against one random opponent, flops, turns and rivers are enumerated
+   * exactly: every runout against every hand the opponent can hold. Other
+   * queries deal the opponents' cards along with the board in each Monte
+   * Carlo simulation. Throws `std::invalid_argument` when there are no
+   * opponents, or not enough players or cards left to deal them.
+   */
+  EvalResult evaluate_vs_random(const Situation& situation, size_t num_opponents) const;
+  EvalResult evaluate_vs_random(const Situation& situation, size_t num_opponents, EvalScratch& scratch) const;
+
+  /**
+   * Strength and potential of the first hand against `range` on a flop, turn
+   * or river board.
+   *
+   * One pass over the runouts ranks the hand and every combo of the range
+   * once per runout, and accumulates both the final hand strength and the
+   * transitions of each combo between ahead, tied and behind. Combos holding
+   * a known or dead card are left out, and so are, on each runout, those
+   * holding one of its cards. Runouts are split over the thread pool like
+   * the other enumerations, with identical results.
+   */
+  HandPotential potential(const Situation& situation, const HandRange& range) const;
 
   /**
    * Simulate num_simulations poker hands and store results in results array.
@@ -25,11 +151,44 @@ public:
    * The results stored are the hand ranks for each player's hand in each simulation.
    * The results array must be large enough to hold num_simulations * number_of_hands values.
    * Return the actual number of simulations performed, so probabilities can be computed.
+   *
+   * Monte Carlo simulations are numbered from `first_simulation`, so one run can be
+   * split into shards whose results match the unsharded run exactly.
+   */
+  size_t simulate(const Situation& situation, uint16_t* results, size_t num_simulations,
+                  uint64_t first_simulation = 0) const;
+  size_t simulate(const Situation& situation, EvalScratch& scratch, uint16_t* results,
+                  size_t num_simulations, uint64_t first_simulation = 0) const;
+
+  /**
+   * Classify every unseen card by who leads once it is dealt.
+   *
+   * The board must hold a flop or a turn. On the flop, `redraws` and
+   * `drawing_dead` look through to the river.
    */
-  size_t simulate(uint16_t* results, size_t num_simulations);
+  OutsResult outs(const Situation& situation) const;
+  OutsResult outs(const Situation& situation, EvalScratch& scratch) const;
+
+  /**
+   * Same queries on the situation built with `set_hands` and `set_board`.
+   */
+  EvalResult evaluate() const { return evaluate(m_situation); }
+
+  EvalResult evaluate_vs_random(size_t num_opponents) const {
+    return evaluate_vs_random(m_situation, num_opponents);
+  }
+
+  size_t simulate(uint16_t* results, size_t num_simulations, uint64_t first_simulation = 0) const {
+    return simulate(m_situation, results, num_simulations, first_simulation);
+  }
+
+  OutsResult outs() const { return outs(m_situation); }
+
+  HandPotential potential(const HandRange& range) const { return potential(m_situation, range); }
 
-  const auto& hands() const { return m_hands; }
-  const auto& board() const { return m_board; }
+  const auto& hands() const { return m_situation.hands; }
+  const auto& board() const { return m_situation.board; }
+  const Situation& situation() const { return m_situation; }
 
   /**
    * Set the hands for the simulation.
@@ -40,37 +199,72 @@ public:
   template <typename InputIterator>
   void set_hands(InputIterator begin, InputIterator end) {
     assert(std::distance(begin, end) >= 2 && std::distance(begin, end) % 2 == 0);
-    m_hands.clear();
+    m_situation.hands.clear();
     for (auto it = begin; it != end; it += 2) {
-      m_hands.emplace_back(std::array<uint32_t, 7>{*it, *(it + 1), 0, 0, 0, 0, 0});
+      m_situation.hands.push_back({*it, *(it + 1)});
     }
   };
 
   template <typename InputIterator>
   void set_board(InputIterator begin, InputIterator end) {
     assert(std::distance(begin, end) <= 5);
-    m_board.clear();
+    m_situation.board.clear();
     for (auto it = begin; it != end; ++it) {
-      m_board.push_back(*it);
+      m_situation.board.push_back(*it);
     }
   }
 
   void set_board() {
-    m_board.clear();
+    m_situation.board.clear();
+  }
+
+  /**
+   * Remove cards from the deck of every query mode. Exact modes stay exact:
+   * they enumerate the runouts of the remaining deck.
+   */
+  template <typename InputIterator>
+  void set_dead_cards(InputIterator begin, InputIterator end) {
+    m_situation.dead = CardSet(begin, end);
+  }
+
+  void set_dead_cards() {
+    m_situation.dead = CardSet();
+  }
+
+  const CardSet& dead_cards() const { return m_situation.dead; }
+
+  /**
+   * Same as `set_hands` and `set_board` for cards given as compact indices.
+   */
+  template <typename InputIterator>
+  void set_hand_indices(InputIterator begin, InputIterator end) {
+    assert(std::distance(begin, end) >= 2 && std::distance(begin, end) % 2 == 0);
+    m_situation.hands.clear();
+    for (auto it = begin; it != end; it += 2) {
+      m_situation.hands.push_back({card_at(*it), card_at(*(it + 1))});
+    }
+  }
+
+  template <typename InputIterator>
+  void set_board_indices(InputIterator begin, InputIterator end) {
+    assert(std::distance(begin, end) <= 5);
+    m_situation.board.clear();
+    for (auto it = begin; it != end; ++it) {
+      m_situation.board.push_back(card_at(*it));
+    }
   }
 
 private:
   // Default number of simulations to run when evaluating preflop hands
   size_t m_num_simulations{100000};
+  uint64_t m_seed;
+  std::shared_ptr<const StateTable> m_state_table;
+  std::shared_ptr<const FlopDatabase> m_flop_database;
+  std::shared_ptr<ThreadPool> m_thread_pool;
+  size_t m_parallel_threshold{DEFAULT_PARALLEL_THRESHOLD};
+  bool m_preflop_tables{true};
 
-  std::array<uint32_t, 52> m_deck;
-  std::vector<std::array<uint32_t, 7>> m_hands;
-  std::vector<uint32_t> m_board;
-  std::vector<uint32_t> m_deck_nodup;
-  std::vector<uint16_t> m_results;
-
-  void simulate_flop(uint16_t* results);
-  void simulate_turn(uint16_t* results);
+  Situation m_situation;
 };
 
 #endif // EVALUATION_H_
@@ -0,0 +1,79 @@
+#ifndef FLOP_DATABASE_H_
+#define FLOP_DATABASE_H_
+
+#include "table_buffer.h"
+#include "types.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+
+/**
+ * Exact heads-up flop equities, computed ahead of time.
+ *
+ * Flops are reduced to one representative per suit permutation, leaving
+ * 1755 flops. For each of them, the database holds the outcome of every pair
+ * of hole-card combos over the 990 turn and river runouts: the number of wins
+ * of the first combo and the number of ties. Both counts fit in 10 bits, so
+ * an entry takes 20 bits, and each flop is a fixed-size chunk of the file
+ * that is found by offset alone.
+ *
+ * The file starts with a header holding a flag per chunk, so a database can
+ * be generated in several runs, and a partial database answers the flops it
+ * holds. Entries are stored little endian.
+ */
+class FlopDatabase {
+public:
+  static constexpr size_t NUM_FLOPS = 1755;
+
+  struct GenerateOptions {
+    size_t first_flop{0};
+    size_t last_flop{NUM_FLOPS - 1};
+    size_t num_threads{1};
+
+    // Called after each chunk written, possibly from several threads at once
+    std::function<void(size_t flop, size_t done, size_t total)> progress;
+  };
+
+  /**
+   * Compute the flops `first_flop..last_flop` missing from the database at
+   * `path`, creating it if needed, and return the number computed. Chunks
+   * are synced to disk before being flagged as present, so an interrupted
+   * run can be resumed. Throws std::runtime_error on I/O errors.
+   */
+  static size_t generate(const std::string& path, const GenerateOptions& options);
+
+  /**
+   * Map a database written by `generate`. Throws std::runtime_error if the
+   * file cannot be mapped or is not a flop database.
+   */
+  static FlopDatabase load(const std::string& path);
+
+  /**
+   * Representative of the given suit-isomorphism class of flops.
+   */
+  static std::array<uint32_t, 3> canonical_flop(size_t flop);
+
+  bool contains(size_t flop) const { return m_present[flop]; }
+  size_t size() const;
+
+  /**
+   * Equity of `hero` against `villain` over the runouts of `flop`, exactly
+   * as `Evaluator::evaluate` enumerates it, or nothing when the flop has not
+   * been generated. The seven cards must be distinct.
+   */
+  std::optional<EvalResult> lookup(const std::array<uint32_t, 2>& hero, const std::array<uint32_t, 2>& villain,
+                                   const std::array<uint32_t, 3>& flop) const;
+
+private:
+  FlopDatabase() = default;
+
+  MappedFile m_file;
+  const uint8_t* m_present{nullptr};
+  const uint8_t* m_chunks{nullptr};
+};
+
+#endif // FLOP_DATABASE_H_
@@ -1,8 +1,11 @@
 #ifndef HAND_RANGE_H_
 #define HAND_RANGE_H_
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 struct WeightedHand {
@@ -10,24 +13,98 @@ struct WeightedHand {
   float weight;
 };
 
+/**
+ * A change to a range: `hand` went from `old_weight` to `new_weight`. Added
+ * hands come from weight 0 and removed hands go to 0.
+ */
+struct RangeChange {
+  std::pair<uint32_t, uint32_t> hand;
+  float old_weight;
+  float new_weight;
+};
+
 class HandRange {
 public:
-  HandRange();
+  HandRange() = default;
+
+  // Copies and moves start a new history
+  HandRange(const HandRange& other) : m_hands(other.m_hands) {}
+  HandRange(HandRange&& other) noexcept : m_hands(std::move(other.m_hands)) { other.clear(); }
+  HandRange& operator=(const HandRange& other) {
+    m_hands = other.m_hands;
+    restart();
+    return *this;
+  }
+  HandRange& operator=(HandRange&& other) noexcept {
+    m_hands = std::move(other.m_hands);
+    restart();
+    other.clear();
+    return *this;
+  }
 
   void addHand(uint32_t card1, uint32_t card2, float weight = 1.f) {
     assert(0.f <= weight && weight <= 1.f && "Weight must be between 0 and 1");
 
     m_hands.push_back({{card1, card2}, weight});
+    record({{card1, card2}, 0.f, weight});
+  }
+
+  void setWeight(size_t i, float weight) {
+    assert(0.f <= weight && weight <= 1.f && "Weight must be between 0 and 1");
+
+    float old_weight = m_hands[i].weight;
+    m_hands[i].weight = weight;
+    record({m_hands[i].hand, old_weight, weight});
+  }
+
+  /**
+   * Remove hand i. The last hand takes its place.
+   */
+  void removeHand(size_t i) {
+    RangeChange change{m_hands[i].hand, m_hands[i].weight, 0.f};
+    m_hands[i] = m_hands.back();
+    m_hands.pop_back();
+    record(change);
   }
 
   void clear() {
     m_hands.clear();
+    restart();
   }
 
   const auto& hands() const { return m_hands; }
 
+  /**
+   * Changes since the range was created, cleared or copied. `epoch` tells
+   * these histories apart across all ranges: having applied the first n
+   * changes of an epoch, a consumer catches up with `changes()` from n on.
+   * Once the log outgrows the range it is dropped and a new epoch begins.
+   */
+  uint64_t epoch() const { return m_epoch; }
+  const std::vector<RangeChange>& changes() const { return m_changes; }
+
 private:
+  static uint64_t next_epoch() {
+    static std::atomic<uint64_t> epochs{0};
+    return ++epochs;
+  }
+
+  void record(const RangeChange& change) {
+    if (m_changes.size() >= 2 * m_hands.size() + 64) {
+      restart();
+    } else {
+      m_changes.push_back(change);
+    }
+  }
+
+  void restart() {
+    m_changes.clear();
+    m_epoch = next_epoch();
+  }
+
   std::vector<WeightedHand> m_hands;
+  std::vector<RangeChange> m_changes;
+  uint64_t m_epoch{next_epoch()};
 };
 
 
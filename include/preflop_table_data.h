@@ -0,0 +1,695 @@
+#ifndef PREFLOP_TABLE_DATA_H_
+#define PREFLOP_TABLE_DATA_H_
+
+// Generated by preflop_table_gen with 1000000 simulations per entry
+
+#include "types.h"
+
+#include <array>
+#include <cstddef>
+
+// Most random opponents covered by the preflop tables
+constexpr size_t MAX_TABLE_OPPONENTS = 9;
+
+// Win and tie probabilities by starting hand class, against 1 to
+// MAX_TABLE_OPPONENTS random hands
+static constexpr std::array<std::array<EvalResult, MAX_TABLE_OPPONENTS>, 169> PREFLOP_VS_RANDOM = {{
+  // As Ah
+  {{{0.849204f, 0.005335f}, {0.731698f, 0.005577f}, {0.635971f, 0.005645f},
+    {0.556736f, 0.005669f}, {0.490136f, 0.005543f}, {0.433530f, 0.005411f},
+    {0.385445f, 0.005227f}, {0.344272f, 0.005101f}, {0.308842f, 0.004943f}}},
+  // As Ks
+  {{{0.661796f, 0.016493f}, {0.497805f, 0.019329f}, {0.404671f, 0.019704f},
+    {0.344734f, 0.019752f}, {0.301851f, 0.019638f}, {0.268165f, 0.019387f},
+    {0.241042f, 0.019260f}, {0.217895f, 0.019128f}, {0.198123f, 0.019035f}}},
+  // As Qs
+  {{{0.652805f, 0.017858f}, {0.483676f, 0.021466f}, {0.387704f, 0.022483f},
+    {0.326125f, 0.022886f}, {0.282894f, 0.022742f}, {0.249564f, 0.022663f},
+    {0.222988f, 0.022416f}, {0.201209f, 0.022083f}, {0.182621f, 0.021725f}}},
+  // As Js
+  {{{0.643942f, 0.020102f}, {0.470510f, 0.024152f}, {0.372627f, 0.025440f},
+    {0.310492f, 0.025861f}, {0.267061f, 0.025817f}, {0.233887f, 0.025742f},
+    {0.208277f, 0.025366f}, {0.187456f, 0.025018f}, {0.170229f, 0.024622f}}},
+  // As Ts
+  {{{0.635345f, 0.022398f}, {0.458382f, 0.027264f}, {0.358928f, 0.028618f},
+    {0.296860f, 0.028854f}, {0.254205f, 0.028654f}, {0.222474f, 0.028387f},
+    {0.197824f, 0.028118f}, {0.177903f, 0.027711f}, {0.161395f, 0.027160f}}},
+  // As 9s
+  {{{0.614774f, 0.025289f}, {0.430714f, 0.030488f}, {0.330223f, 0.031093f},
+    {0.268718f, 0.030683f}, {0.227560f, 0.029944f}, {0.197432f, 0.029173f},
+    {0.174590f, 0.028353f}, {0.156366f, 0.027581f}, {0.141800f, 0.026712f}}},
+  // As 8s
+  {{{0.605195f, 0.028686f}, {0.419160f, 0.033900f}, {0.318775f, 0.034395f},
+    {0.258319f, 0.033583f}, {0.217826f, 0.032657f}, {0.188365f, 0.031587f},
+    {0.166367f, 0.030596f}, {0.149086f, 0.029485f}, {0.135158f, 0.028585f}}},
+  // As 7s
+  {{{0.593686f, 0.031996f}, {0.405902f, 0.036918f}, {0.306396f, 0.036682f},
+    {0.247294f, 0.035424f}, {0.208400f, 0.034216f}, {0.180143f, 0.033133f},
+    {0.159138f, 0.032006f}, {0.142734f, 0.030911f}, {0.129554f, 0.029801f}}},
+  // As 6s
+  {{{0.582142f, 0.034515f}, {0.393505f, 0.038677f}, {0.294822f, 0.038085f},
+    {0.237164f, 0.036646f}, {0.199732f, 0.035346f}, {0.172706f, 0.034245f},
+    {0.153023f, 0.032979f}, {0.137527f, 0.031817f}, {0.125294f, 0.030706f}}},
+  // As 5s
+  {{{0.580533f, 0.037135f}, {0.394352f, 0.041225f}, {0.297886f, 0.040115f},
+    {0.241332f, 0.038588f}, {0.204322f, 0.037086f}, {0.177629f, 0.035822f},
+    {0.157766f, 0.034653f}, {0.142098f, 0.033394f}, {0.129523f, 0.032088f}}},
+  // As 4s
+  {{{0.571819f, 0.037810f}, {0.385736f, 0.041285f}, {0.290673f, 0.039848f},
+    {0.235743f, 0.037926f}, {0.199913f, 0.036292f}, {0.174142f, 0.034872f},
+    {0.154977f, 0.033472f}, {0.140028f, 0.031956f}, {0.127959f, 0.030520f}}},
+  // As 3s
+  {{{0.563344f, 0.037616f}, {0.376878f, 0.040604f}, {0.283513f, 0.038633f},
+    {0.229966f, 0.036411f}, {0.195569f, 0.034456f}, {0.170827f, 0.032977f},
+    {0.152548f, 0.031463f}, {0.138058f, 0.029921f}, {0.126342f, 0.028428f}}},
+  // As 2s
+  {{{0.554916f, 0.037538f}, {0.368318f, 0.040261f}, {0.276084f, 0.037987f},
+    {0.223707f, 0.035413f}, {0.190311f, 0.033186f}, {0.166508f, 0.031350f},
+    {0.148796f, 0.029567f}, {0.134892f, 0.027810f}, {0.123541f, 0.026146f}}},
+  // As Kh
+  {{{0.644182f, 0.016700f}, {0.472304f, 0.019753f}, {0.375188f, 0.020450f},
+    {0.313173f, 0.020349f}, {0.268894f, 0.020113f}, {0.234144f, 0.020052f},
+    {0.206180f, 0.019894f}, {0.182581f, 0.019790f}, {0.162616f, 0.019623f}}},
+  // Ks Kh
+  {{{0.821273f, 0.005587f}, {0.685788f, 0.005894f}, {0.579955f, 0.006024f},
+    {0.495596f, 0.006077f}, {0.427762f, 0.006138f}, {0.372133f, 0.006136f},
+    {0.326793f, 0.006127f}, {0.289542f, 0.006075f}, {0.258707f, 0.006081f}}},
+  // Ks Qs
+  {{{0.623557f, 0.019873f}, {0.460231f, 0.021888f}, {0.371306f, 0.021895f},
+    {0.314404f, 0.021814f}, {0.273332f, 0.021698f}, {0.241430f, 0.021469f},
+    {0.215929f, 0.021414f}, {0.194838f, 0.021260f}, {0.176803f, 0.021096f}}},
+  // Ks Js
+  {{{0.614361f, 0.021843f}, {0.447239f, 0.024368f}, {0.356771f, 0.024640f},
+    {0.299378f, 0.024556f}, {0.258504f, 0.024425f}, {0.227298f, 0.024314f},
+    {0.202678f, 0.024131f}, {0.182611f, 0.023913f}, {0.165860f, 0.023754f}}},
+  // Ks Ts
+  {{{0.606170f, 0.024007f}, {0.435512f, 0.027036f}, {0.343648f, 0.027379f},
+    {0.286275f, 0.027150f}, {0.246131f, 0.027038f}, {0.215627f, 0.027031f},
+    {0.192100f, 0.026868f}, {0.173027f, 0.026638f}, {0.157343f, 0.026408f}}},
+  // Ks 9s
+  {{{0.586098f, 0.026684f}, {0.408619f, 0.029627f}, {0.315492f, 0.028906f},
+    {0.258456f, 0.027865f}, {0.219638f, 0.027044f}, {0.191021f, 0.026258f},
+    {0.169239f, 0.025674f}, {0.151647f, 0.025277f}, {0.137639f, 0.024761f}}},
+  // Ks 8s
+  {{{0.567489f, 0.030502f}, {0.385723f, 0.032992f}, {0.293028f, 0.031527f},
+    {0.237674f, 0.030100f}, {0.200600f, 0.029069f}, {0.173589f, 0.028116f},
+    {0.153405f, 0.027382f}, {0.137270f, 0.026824f}, {0.124338f, 0.026353f}}},
+  // Ks 7s
+  {{{0.558105f, 0.033824f}, {0.375075f, 0.036055f}, {0.282838f, 0.034247f},
+    {0.228406f, 0.032313f}, {0.192297f, 0.031039f}, {0.166302f, 0.029815f},
+    {0.146863f, 0.028939f}, {0.131414f, 0.028171f}, {0.119133f, 0.027315f}}},
+  // Ks 6s
+  {{{0.547905f, 0.036665f}, {0.364394f, 0.038207f}, {0.273190f, 0.035862f},
+    {0.220051f, 0.033677f}, {0.185134f, 0.032299f}, {0.160195f, 0.031099f},
+    {0.141424f, 0.030011f}, {0.126912f, 0.029102f}, {0.115382f, 0.028182f}}},
+  // Ks 5s
+  {{{0.538111f, 0.039028f}, {0.354467f, 0.040039f}, {0.264624f, 0.037155f},
+    {0.213035f, 0.034650f}, {0.179335f, 0.033030f}, {0.155387f, 0.031638f},
+    {0.137461f, 0.030623f}, {0.123380f, 0.029688f}, {0.112209f, 0.028572f}}},
+  // Ks 4s
+  {{{0.528781f, 0.039972f}, {0.346308f, 0.039886f}, {0.258293f, 0.036529f},
+    {0.208079f, 0.033782f}, {0.175411f, 0.032008f}, {0.152385f, 0.030505f},
+    {0.135169f, 0.029235f}, {0.121520f, 0.028089f}, {0.110792f, 0.026843f}}},
+  // Ks 3s
+  {{{0.520501f, 0.039815f}, {0.338355f, 0.039129f}, {0.252026f, 0.035312f},
+    {0.203495f, 0.032213f}, {0.172044f, 0.030149f}, {0.150021f, 0.028476f},
+    {0.133587f, 0.027049f}, {0.120640f, 0.025791f}, {0.110179f, 0.024608f}}},
+  // Ks 2s
+  {{{0.511926f, 0.039680f}, {0.330561f, 0.038681f}, {0.245652f, 0.034642f},
+    {0.198593f, 0.031295f}, {0.168474f, 0.028950f}, {0.147409f, 0.026996f},
+    {0.131720f, 0.025396f}, {0.119267f, 0.024026f}, {0.109186f, 0.022670f}}},
+  // As Qh
+  {{{0.634598f, 0.018322f}, {0.457224f, 0.022382f}, {0.356982f, 0.023496f},
+    {0.293054f, 0.023606f}, {0.248139f, 0.023500f}, {0.213464f, 0.023335f},
+    {0.186119f, 0.023103f}, {0.163489f, 0.022841f}, {0.144718f, 0.022489f}}},
+  // Ks Qh
+  {{{0.604604f, 0.020256f}, {0.433540f, 0.022458f}, {0.341589f, 0.022478f},
+    {0.283059f, 0.022311f}, {0.240862f, 0.022110f}, {0.207958f, 0.021914f},
+    {0.181497f, 0.021813f}, {0.159539f, 0.021737f}, {0.141332f, 0.021572f}}},
+  // Qs Qh
+  {{{0.796419f, 0.005744f}, {0.646529f, 0.006252f}, {0.532708f, 0.006563f},
+    {0.444791f, 0.006890f}, {0.376480f, 0.007101f}, {0.322398f, 0.007287f},
+    {0.279938f, 0.007400f}, {0.246158f, 0.007507f}, {0.219372f, 0.007612f}}},
+  // Qs Js
+  {{{0.590468f, 0.023767f}, {0.429898f, 0.025133f}, {0.345277f, 0.024896f},
+    {0.290852f, 0.024663f}, {0.251882f, 0.024559f}, {0.221296f, 0.024449f},
+    {0.197367f, 0.024287f}, {0.177945f, 0.024246f}, {0.161941f, 0.024299f}}},
+  // Qs Ts
+  {{{0.582574f, 0.025748f}, {0.418852f, 0.027335f}, {0.332811f, 0.027070f},
+    {0.278638f, 0.026820f}, {0.239783f, 0.026802f}, {0.210337f, 0.026723f},
+    {0.187465f, 0.026668f}, {0.169144f, 0.026533f}, {0.154033f, 0.026437f}}},
+  // Qs 9s
+  {{{0.562588f, 0.028627f}, {0.392723f, 0.029596f}, {0.305709f, 0.028258f},
+    {0.251835f, 0.027143f}, {0.214445f, 0.026331f}, {0.186748f, 0.025743f},
+    {0.165546f, 0.025253f}, {0.148584f, 0.024853f}, {0.134861f, 0.024527f}}},
+  // Qs 8s
+  {{{0.544484f, 0.032100f}, {0.370382f, 0.032534f}, {0.283267f, 0.030434f},
+    {0.230799f, 0.028786f}, {0.195013f, 0.027765f}, {0.168931f, 0.026864f},
+    {0.149189f, 0.026249f}, {0.133653f, 0.025629f}, {0.121080f, 0.025221f}}},
+  // Qs 7s
+  {{{0.525251f, 0.035918f}, {0.347870f, 0.035399f}, {0.261801f, 0.032453f},
+    {0.211178f, 0.030399f}, {0.177353f, 0.029318f}, {0.152942f, 0.028312f},
+    {0.134747f, 0.027723f}, {0.120560f, 0.027069f}, {0.109223f, 0.026560f}}},
+  // Qs 6s
+  {{{0.517175f, 0.038791f}, {0.339753f, 0.037503f}, {0.254115f, 0.034251f},
+    {0.204336f, 0.032019f}, {0.171271f, 0.030699f}, {0.147724f, 0.029602f},
+    {0.130215f, 0.028702f}, {0.116714f, 0.027935f}, {0.105802f, 0.027225f}}},
+  // Qs 5s
+  {{{0.507227f, 0.041233f}, {0.329851f, 0.039079f}, {0.245534f, 0.035327f},
+    {0.197215f, 0.032934f}, {0.165624f, 0.031286f}, {0.143176f, 0.030090f},
+    {0.126505f, 0.029216f}, {0.113520f, 0.028389f}, {0.103000f, 0.027540f}}},
+  // Qs 4s
+  {{{0.497736f, 0.041974f}, {0.321844f, 0.038778f}, {0.239566f, 0.034494f},
+    {0.192617f, 0.031907f}, {0.161968f, 0.030201f}, {0.140375f, 0.028892f},
+    {0.124446f, 0.027814f}, {0.111988f, 0.026733f}, {0.101969f, 0.025768f}}},
+  // Qs 3s
+  {{{0.489486f, 0.041700f}, {0.314078f, 0.038042f}, {0.233245f, 0.033205f},
+    {0.188073f, 0.030166f}, {0.158745f, 0.028193f}, {0.138100f, 0.026726f},
+    {0.122962f, 0.025518f}, {0.110972f, 0.024389f}, {0.101280f, 0.023435f}}},
+  // Qs 2s
+  {{{0.480623f, 0.041488f}, {0.306429f, 0.037342f}, {0.227248f, 0.032253f},
+    {0.183525f, 0.028965f}, {0.155529f, 0.026817f}, {0.135908f, 0.025070f},
+    {0.121487f, 0.023721f}, {0.110004f, 0.022333f}, {0.100659f, 0.021244f}}},
+  // As Jh
+  {{{0.625310f, 0.020510f}, {0.443051f, 0.024953f}, {0.340509f, 0.026293f},
+    {0.276026f, 0.026500f}, {0.231099f, 0.026391f}, {0.196956f, 0.026204f},
+    {0.170337f, 0.025961f}, {0.148872f, 0.025680f}, {0.131332f, 0.025283f}}},
+  // Ks Jh
+  {{{0.594586f, 0.022304f}, {0.418987f, 0.024881f}, {0.324957f, 0.025262f},
+    {0.266134f, 0.025030f}, {0.223804f, 0.025002f}, {0.191651f, 0.024685f},
+    {0.166139f, 0.024619f}, {0.145512f, 0.024386f}, {0.128583f, 0.024139f}}},
+  // Qs Jh
+  {{{0.569190f, 0.024344f}, {0.401576f, 0.025627f}, {0.313738f, 0.025374f},
+    {0.257830f, 0.025262f}, {0.217568f, 0.025254f}, {0.186474f, 0.024980f},
+    {0.162087f, 0.024797f}, {0.142366f, 0.024621f}, {0.126230f, 0.024648f}}},
+  // Js Jh
+  {{{0.771586f, 0.006244f}, {0.608491f, 0.007016f}, {0.488621f, 0.007559f},
+    {0.399459f, 0.007956f}, {0.332491f, 0.008236f}, {0.281574f, 0.008510f},
+    {0.242852f, 0.008750f}, {0.212903f, 0.008957f}, {0.189585f, 0.009193f}}},
+  // Js Ts
+  {{{0.561540f, 0.027584f}, {0.406959f, 0.027767f}, {0.326659f, 0.027308f},
+    {0.274548f, 0.027170f}, {0.236945f, 0.027273f}, {0.208385f, 0.027321f},
+    {0.185859f, 0.027374f}, {0.168027f, 0.027296f}, {0.153676f, 0.027342f}}},
+  // Js 9s
+  {{{0.541183f, 0.030803f}, {0.380768f, 0.030044f}, {0.299654f, 0.028354f},
+    {0.248037f, 0.027541f}, {0.211936f, 0.026942f}, {0.184819f, 0.026406f},
+    {0.163953f, 0.025939f}, {0.147602f, 0.025490f}, {0.134658f, 0.025308f}}},
+  // Js 8s
+  {{{0.522793f, 0.034158f}, {0.358644f, 0.032416f}, {0.277736f, 0.029951f},
+    {0.227675f, 0.028586f}, {0.193030f, 0.027792f}, {0.167512f, 0.027097f},
+    {0.148263f, 0.026503f}, {0.133420f, 0.025921f}, {0.121408f, 0.025718f}}},
+  // Js 7s
+  {{{0.504786f, 0.037379f}, {0.337378f, 0.034678f}, {0.257202f, 0.031377f},
+    {0.208509f, 0.029586f}, {0.175609f, 0.028571f}, {0.151928f, 0.027659f},
+    {0.134033f, 0.027111f}, {0.120208f, 0.026588f}, {0.109279f, 0.026233f}}},
+  // Js 6s
+  {{{0.485836f, 0.040799f}, {0.316637f, 0.036683f}, {0.237573f, 0.032712f},
+    {0.190854f, 0.030796f}, {0.159989f, 0.029802f}, {0.137963f, 0.028932f},
+    {0.121385f, 0.028360f}, {0.108709f, 0.027780f}, {0.098708f, 0.027459f}}},
+  // Js 5s
+  {{{0.478282f, 0.043287f}, {0.309398f, 0.038447f}, {0.231268f, 0.034180f},
+    {0.185297f, 0.032103f}, {0.155306f, 0.030842f}, {0.134018f, 0.029825f},
+    {0.118058f, 0.029043f}, {0.105636f, 0.028397f}, {0.095772f, 0.027829f}}},
+  // Js 4s
+  {{{0.468677f, 0.044344f}, {0.301647f, 0.038148f}, {0.224963f, 0.033390f},
+    {0.180548f, 0.031024f}, {0.151423f, 0.029532f}, {0.131007f, 0.028344f},
+    {0.115914f, 0.027299f}, {0.104042f, 0.026491f}, {0.094585f, 0.025859f}}},
+  // Js 3s
+  {{{0.460573f, 0.043816f}, {0.293831f, 0.037229f}, {0.218992f, 0.032149f},
+    {0.176389f, 0.029392f}, {0.148619f, 0.027665f}, {0.129137f, 0.026315f},
+    {0.114735f, 0.025275f}, {0.103462f, 0.024329f}, {0.094254f, 0.023740f}}},
+  // Js 2s
+  {{{0.451829f, 0.043755f}, {0.286733f, 0.036538f}, {0.213252f, 0.031019f},
+    {0.171829f, 0.028086f}, {0.145316f, 0.026177f}, {0.126788f, 0.024598f},
+    {0.112879f, 0.023429f}, {0.102142f, 0.022299f}, {0.093398f, 0.021510f}}},
+  // As Th
+  {{{0.615524f, 0.022782f}, {0.429267f, 0.028003f}, {0.325685f, 0.029467f},
+    {0.261045f, 0.029675f}, {0.216641f, 0.029490f}, {0.183717f, 0.029297f},
+    {0.158036f, 0.029118f}, {0.137520f, 0.028836f}, {0.120593f, 0.028426f}}},
+  // Ks Th
+  {{{0.584882f, 0.024707f}, {0.405402f, 0.027723f}, {0.310593f, 0.028051f},
+    {0.251429f, 0.028032f}, {0.209936f, 0.027986f}, {0.178586f, 0.027949f},
+    {0.154047f, 0.027961f}, {0.134268f, 0.027774f}, {0.118515f, 0.027438f}}},
+  // Qs Th
+  {{{0.559600f, 0.026514f}, {0.389039f, 0.028105f}, {0.300270f, 0.027878f},
+    {0.244149f, 0.027883f}, {0.204518f, 0.027864f}, {0.174397f, 0.027817f},
+    {0.151013f, 0.027707f}, {0.132261f, 0.027618f}, {0.117048f, 0.027554f}}},
+  // Js Th
+  {{{0.538166f, 0.028493f}, {0.377208f, 0.028456f}, {0.294059f, 0.028052f},
+    {0.240743f, 0.028092f}, {0.202101f, 0.028206f}, {0.172985f, 0.028243f},
+    {0.150432f, 0.028239f}, {0.132548f, 0.028244f}, {0.118229f, 0.028389f}}},
+  // Ts Th
+  {{{0.747102f, 0.006949f}, {0.572559f, 0.007824f}, {0.448918f, 0.008448f},
+    {0.359901f, 0.009061f}, {0.295683f, 0.009431f}, {0.248112f, 0.009798f},
+    {0.213221f, 0.010254f}, {0.186855f, 0.010661f}, {0.166705f, 0.011016f}}},
+  // Ts 9s
+  {{{0.524537f, 0.033052f}, {0.374360f, 0.030626f}, {0.297140f, 0.029019f},
+    {0.247341f, 0.028141f}, {0.212058f, 0.027678f}, {0.185829f, 0.027325f},
+    {0.165839f, 0.026960f}, {0.149985f, 0.026670f}, {0.137401f, 0.026594f}}},
+  // Ts 8s
+  {{{0.505767f, 0.036588f}, {0.352273f, 0.032618f}, {0.275409f, 0.030340f},
+    {0.227067f, 0.029082f}, {0.193288f, 0.028216f}, {0.168682f, 0.027675f},
+    {0.150377f, 0.027180f}, {0.135827f, 0.026787f}, {0.124350f, 0.026600f}}},
+  // Ts 7s
+  {{{0.487055f, 0.040144f}, {0.330878f, 0.034625f}, {0.255120f, 0.031214f},
+    {0.208378f, 0.029524f}, {0.176422f, 0.028441f}, {0.153209f, 0.027777f},
+    {0.135903f, 0.027324f}, {0.122465f, 0.027009f}, {0.111916f, 0.026768f}}},
+  // Ts 6s
+  {{{0.468571f, 0.043027f}, {0.310829f, 0.036032f}, {0.235853f, 0.032119f},
+    {0.190959f, 0.030214f}, {0.160635f, 0.029128f}, {0.138829f, 0.028336f},
+    {0.122754f, 0.027823f}, {0.110332f, 0.027478f}, {0.100546f, 0.027293f}}},
+  // Ts 5s
+  {{{0.449781f, 0.045929f}, {0.291106f, 0.037509f}, {0.217883f, 0.032934f},
+    {0.175014f, 0.030924f}, {0.146499f, 0.029710f}, {0.126270f, 0.028985f},
+    {0.111322f, 0.028571f}, {0.099541f, 0.028377f}, {0.090383f, 0.028185f}}},
+  // Ts 4s
+  {{{0.442309f, 0.046776f}, {0.285162f, 0.037670f}, {0.213015f, 0.032752f},
+    {0.170976f, 0.030485f}, {0.143319f, 0.029100f}, {0.123851f, 0.028147f},
+    {0.109422f, 0.027368f}, {0.098014f, 0.026812f}, {0.089188f, 0.026365f}}},
+  // Ts 3s
+  {{{0.434046f, 0.046505f}, {0.277515f, 0.036673f}, {0.207107f, 0.031359f},
+    {0.166792f, 0.028725f}, {0.140446f, 0.027059f}, {0.121699f, 0.025942f},
+    {0.108057f, 0.025121f}, {0.097184f, 0.024455f}, {0.088479f, 0.024055f}}},
+  // Ts 2s
+  {{{0.425010f, 0.046340f}, {0.270245f, 0.036024f}, {0.201714f, 0.030331f},
+    {0.162794f, 0.027426f}, {0.137487f, 0.025584f}, {0.119712f, 0.024208f},
+    {0.106617f, 0.023306f}, {0.096269f, 0.022496f}, {0.087948f, 0.021999f}}},
+  // As 9h
+  {{{0.593823f, 0.026308f}, {0.400193f, 0.031756f}, {0.294925f, 0.032268f},
+    {0.230881f, 0.031801f}, {0.187871f, 0.031112f}, {0.156682f, 0.030325f},
+    {0.132764f, 0.029633f}, {0.113946f, 0.028990f}, {0.099037f, 0.028015f}}},
+  // Ks 9h
+  {{{0.564213f, 0.027730f}, {0.377398f, 0.030652f}, {0.280512f, 0.029992f},
+    {0.221718f, 0.029127f}, {0.181439f, 0.028294f}, {0.151866f, 0.027448f},
+    {0.129309f, 0.026917f}, {0.111139f, 0.026273f}, {0.096775f, 0.025656f}}},
+  // Qs 9h
+  {{{0.538637f, 0.029737f}, {0.360814f, 0.030840f}, {0.270447f, 0.029500f},
+    {0.214637f, 0.028668f}, {0.176284f, 0.028046f}, {0.147850f, 0.027304f},
+    {0.126173f, 0.026771f}, {0.109169f, 0.026154f}, {0.095591f, 0.025669f}}},
+  // Js 9h
+  {{{0.516010f, 0.031918f}, {0.349032f, 0.030909f}, {0.264786f, 0.029415f},
+    {0.211606f, 0.028594f}, {0.174300f, 0.028062f}, {0.146780f, 0.027563f},
+    {0.126102f, 0.027072f}, {0.109785f, 0.026653f}, {0.096905f, 0.026425f}}},
+  // Ts 9h
+  {{{0.498769f, 0.034004f}, {0.342631f, 0.031229f}, {0.263153f, 0.029651f},
+    {0.212018f, 0.028952f}, {0.175945f, 0.028550f}, {0.149394f, 0.028136f},
+    {0.129183f, 0.028034f}, {0.113377f, 0.027796f}, {0.101011f, 0.027730f}}},
+  // 9s 9h
+  {{{0.716476f, 0.007752f}, {0.532632f, 0.007989f}, {0.408483f, 0.008054f},
+    {0.322926f, 0.008173f}, {0.263261f, 0.008260f}, {0.220984f, 0.008340f},
+    {0.190965f, 0.008426f}, {0.168868f, 0.008523f}, {0.152204f, 0.008653f}}},
+  // 9s 8s
+  {{{0.488846f, 0.039049f}, {0.345248f, 0.032319f}, {0.271778f, 0.029283f},
+    {0.224484f, 0.027595f}, {0.191415f, 0.026386f}, {0.167405f, 0.025349f},
+    {0.149240f, 0.024593f}, {0.135106f, 0.023936f}, {0.123943f, 0.023606f}}},
+  // 9s 7s
+  {{{0.470061f, 0.042814f}, {0.325394f, 0.034063f}, {0.252953f, 0.030288f},
+    {0.207589f, 0.028231f}, {0.176593f, 0.026839f}, {0.154363f, 0.025666f},
+    {0.137721f, 0.024940f}, {0.124839f, 0.024329f}, {0.114690f, 0.023989f}}},
+  // 9s 6s
+  {{{0.452154f, 0.045947f}, {0.306307f, 0.035614f}, {0.234954f, 0.031103f},
+    {0.191170f, 0.028700f}, {0.161889f, 0.027289f}, {0.141048f, 0.025976f},
+    {0.125641f, 0.025050f}, {0.113677f, 0.024256f}, {0.104274f, 0.023909f}}},
+  // 9s 5s
+  {{{0.433596f, 0.048427f}, {0.286032f, 0.036615f}, {0.216204f, 0.031497f},
+    {0.174465f, 0.028967f}, {0.147146f, 0.027394f}, {0.127689f, 0.026151f},
+    {0.113405f, 0.025224f}, {0.102079f, 0.024572f}, {0.093200f, 0.024149f}}},
+  // 9s 4s
+  {{{0.414729f, 0.049427f}, {0.267892f, 0.036149f}, {0.200018f, 0.030646f},
+    {0.160462f, 0.027887f}, {0.134737f, 0.026246f}, {0.116700f, 0.025059f},
+    {0.103489f, 0.024191f}, {0.093007f, 0.023477f}, {0.084758f, 0.023084f}}},
+  // 9s 3s
+  {{{0.408440f, 0.049430f}, {0.261821f, 0.035916f}, {0.195295f, 0.030046f},
+    {0.156956f, 0.027012f}, {0.132183f, 0.024968f}, {0.114658f, 0.023524f},
+    {0.101875f, 0.022435f}, {0.091857f, 0.021560f}, {0.083725f, 0.021077f}}},
+  // 9s 2s
+  {{{0.399702f, 0.049197f}, {0.255131f, 0.035255f}, {0.190142f, 0.028997f},
+    {0.153078f, 0.025672f}, {0.129330f, 0.023501f}, {0.112744f, 0.021802f},
+    {0.100549f, 0.020657f}, {0.091021f, 0.019569f}, {0.083227f, 0.018951f}}},
+  // As 8h
+  {{{0.583173f, 0.029839f}, {0.386943f, 0.035404f}, {0.281448f, 0.035874f},
+    {0.218744f, 0.034826f}, {0.176682f, 0.033778f}, {0.146218f, 0.032761f},
+    {0.123490f, 0.031699f}, {0.105747f, 0.030705f}, {0.091643f, 0.029598f}}},
+  // Ks 8h
+  {{{0.543827f, 0.031831f}, {0.352741f, 0.034124f}, {0.255531f, 0.032768f},
+    {0.198559f, 0.031392f}, {0.160224f, 0.030420f}, {0.132392f, 0.029479f},
+    {0.111609f, 0.028704f}, {0.095198f, 0.028092f}, {0.082348f, 0.027400f}}},
+  // Qs 8h
+  {{{0.519133f, 0.033438f}, {0.336876f, 0.033792f}, {0.246131f, 0.031688f},
+    {0.191862f, 0.030285f}, {0.155293f, 0.029180f}, {0.128496f, 0.028273f},
+    {0.108525f, 0.027614f}, {0.093003f, 0.027000f}, {0.080678f, 0.026480f}}},
+  // Js 8h
+  {{{0.497179f, 0.035470f}, {0.325723f, 0.033658f}, {0.241461f, 0.031174f},
+    {0.189749f, 0.029777f}, {0.154385f, 0.028924f}, {0.128272f, 0.028337f},
+    {0.109085f, 0.027711f}, {0.094406f, 0.027138f}, {0.082686f, 0.026801f}}},
+  // Ts 8h
+  {{{0.478907f, 0.038042f}, {0.319250f, 0.033659f}, {0.239960f, 0.031061f},
+    {0.190288f, 0.030024f}, {0.155799f, 0.029288f}, {0.130927f, 0.028727f},
+    {0.112414f, 0.028440f}, {0.097913f, 0.028070f}, {0.086608f, 0.027957f}}},
+  // 9s 8h
+  {{{0.460630f, 0.040518f}, {0.312081f, 0.033235f}, {0.236564f, 0.030144f},
+    {0.187741f, 0.028711f}, {0.153919f, 0.027548f}, {0.129616f, 0.026433f},
+    {0.111773f, 0.025641f}, {0.098285f, 0.024942f}, {0.087581f, 0.024507f}}},
+  // 8s 8h
+  {{{0.687244f, 0.008946f}, {0.496097f, 0.008523f}, {0.372942f, 0.008300f},
+    {0.291424f, 0.008298f}, {0.237080f, 0.008298f}, {0.199590f, 0.008342f},
+    {0.173468f, 0.008417f}, {0.154701f, 0.008478f}, {0.141140f, 0.008588f}}},
+  // 8s 7s
+  {{{0.456749f, 0.045113f}, {0.322804f, 0.033838f}, {0.253343f, 0.029764f},
+    {0.209149f, 0.027634f}, {0.178447f, 0.026174f}, {0.156582f, 0.025167f},
+    {0.140477f, 0.024408f}, {0.127900f, 0.023811f}, {0.117781f, 0.023519f}}},
+  // 8s 6s
+  {{{0.438869f, 0.048478f}, {0.304779f, 0.034951f}, {0.236163f, 0.030415f},
+    {0.193699f, 0.028143f}, {0.165014f, 0.026499f}, {0.144860f, 0.025217f},
+    {0.130075f, 0.024338f}, {0.118496f, 0.023687f}, {0.109286f, 0.023341f}}},
+  // 8s 5s
+  {{{0.419869f, 0.051176f}, {0.284718f, 0.035941f}, {0.217865f, 0.030685f},
+    {0.177432f, 0.028117f}, {0.150522f, 0.026456f}, {0.131853f, 0.025183f},
+    {0.118039f, 0.024274f}, {0.107129f, 0.023740f}, {0.098467f, 0.023449f}}},
+  // 8s 4s
+  {{{0.400906f, 0.052107f}, {0.266062f, 0.035571f}, {0.201448f, 0.029743f},
+    {0.163071f, 0.026842f}, {0.138057f, 0.024892f}, {0.120398f, 0.023633f},
+    {0.107495f, 0.022646f}, {0.097248f, 0.022059f}, {0.089122f, 0.021601f}}},
+  // 8s 3s
+  {{{0.382983f, 0.051833f}, {0.247971f, 0.034816f}, {0.185611f, 0.028621f},
+    {0.149508f, 0.025580f}, {0.126147f, 0.023590f}, {0.109840f, 0.022298f},
+    {0.098088f, 0.021380f}, {0.088525f, 0.020826f}, {0.080781f, 0.020489f}}},
+  // 8s 2s
+  {{{0.376355f, 0.051973f}, {0.242755f, 0.034541f}, {0.181440f, 0.028011f},
+    {0.146340f, 0.024702f}, {0.123675f, 0.022543f}, {0.108066f, 0.020955f},
+    {0.096330f, 0.019862f}, {0.087082f, 0.018964f}, {0.079668f, 0.018382f}}},
+  // As 7h
+  {{{0.571119f, 0.033339f}, {0.373463f, 0.038526f}, {0.268400f, 0.038585f},
+    {0.206905f, 0.037106f}, {0.165995f, 0.036023f}, {0.136811f, 0.034896f},
+    {0.115365f, 0.033708f}, {0.098540f, 0.032599f}, {0.085321f, 0.031338f}}},
+  // Ks 7h
+  {{{0.533698f, 0.035369f}, {0.341339f, 0.037470f}, {0.244777f, 0.035560f},
+    {0.188417f, 0.033807f}, {0.150906f, 0.032643f}, {0.124092f, 0.031423f},
+    {0.104313f, 0.030454f}, {0.088617f, 0.029522f}, {0.076560f, 0.028629f}}},
+  // Qs 7h
+  {{{0.498847f, 0.037536f}, {0.313166f, 0.036910f}, {0.223179f, 0.034103f},
+    {0.171050f, 0.032155f}, {0.136364f, 0.030888f}, {0.111426f, 0.029773f},
+    {0.093170f, 0.029166f}, {0.078999f, 0.028485f}, {0.067981f, 0.027958f}}},
+  // Js 7h
+  {{{0.477171f, 0.038877f}, {0.302433f, 0.035942f}, {0.218705f, 0.032683f},
+    {0.168721f, 0.030936f}, {0.135242f, 0.029873f}, {0.111214f, 0.028986f},
+    {0.093459f, 0.028395f}, {0.079915f, 0.027863f}, {0.069219f, 0.027542f}}},
+  // Ts 7h
+  {{{0.458910f, 0.041676f}, {0.296414f, 0.035789f}, {0.217677f, 0.032387f},
+    {0.169710f, 0.030847f}, {0.137167f, 0.029886f}, {0.113925f, 0.029127f},
+    {0.096812f, 0.028776f}, {0.083562f, 0.028476f}, {0.073257f, 0.028345f}}},
+  // 9s 7h
+  {{{0.440565f, 0.044496f}, {0.290484f, 0.035261f}, {0.216271f, 0.031237f},
+    {0.170026f, 0.029224f}, {0.138289f, 0.028000f}, {0.115820f, 0.026796f},
+    {0.099645f, 0.026002f}, {0.087263f, 0.025468f}, {0.077627f, 0.025171f}}},
+  // 8s 7h
+  {{{0.427177f, 0.047220f}, {0.288427f, 0.034935f}, {0.217072f, 0.030907f},
+    {0.171758f, 0.028926f}, {0.140813f, 0.027397f}, {0.118974f, 0.026187f},
+    {0.103298f, 0.025328f}, {0.091144f, 0.024650f}, {0.081819f, 0.024318f}}},
+  // 7s 7h
+  {{{0.658040f, 0.010124f}, {0.461667f, 0.008942f}, {0.341166f, 0.008333f},
+    {0.265011f, 0.008154f}, {0.215958f, 0.008130f}, {0.182935f, 0.008084f},
+    {0.160561f, 0.008176f}, {0.144655f, 0.008294f}, {0.133065f, 0.008450f}}},
+  // 7s 6s
+  {{{0.428605f, 0.051290f}, {0.304189f, 0.034777f}, {0.237666f, 0.030035f},
+    {0.195838f, 0.027533f}, {0.167697f, 0.025804f}, {0.147954f, 0.024488f},
+    {0.133489f, 0.023708f}, {0.122057f, 0.023203f}, {0.112818f, 0.022986f}}},
+  // 7s 5s
+  {{{0.409617f, 0.054373f}, {0.285161f, 0.035605f}, {0.221168f, 0.030176f},
+    {0.181731f, 0.027460f}, {0.155786f, 0.025579f}, {0.137586f, 0.024342f},
+    {0.124068f, 0.023516f}, {0.113329f, 0.023107f}, {0.104672f, 0.022945f}}},
+  // 7s 4s
+  {{{0.391238f, 0.055225f}, {0.267390f, 0.035023f}, {0.204939f, 0.029280f},
+    {0.167526f, 0.026222f}, {0.143258f, 0.024084f}, {0.126237f, 0.022753f},
+    {0.113727f, 0.021785f}, {0.103700f, 0.021294f}, {0.095624f, 0.020963f}}},
+  // 7s 3s
+  {{{0.372910f, 0.054960f}, {0.248676f, 0.034220f}, {0.188537f, 0.027871f},
+    {0.153253f, 0.024558f}, {0.130409f, 0.022394f}, {0.114699f, 0.020914f},
+    {0.103072f, 0.020051f}, {0.093702f, 0.019505f}, {0.086006f, 0.019143f}}},
+  // 7s 2s
+  {{{0.353650f, 0.054729f}, {0.230438f, 0.033353f}, {0.172903f, 0.026612f},
+    {0.140121f, 0.023181f}, {0.118979f, 0.021053f}, {0.104429f, 0.019587f},
+    {0.093620f, 0.018835f}, {0.084936f, 0.018189f}, {0.077743f, 0.017825f}}},
+  // As 6h
+  {{{0.558093f, 0.036245f}, {0.359080f, 0.040650f}, {0.255619f, 0.040061f},
+    {0.195956f, 0.038288f}, {0.156986f, 0.036826f}, {0.129598f, 0.035551f},
+    {0.109216f, 0.034427f}, {0.093467f, 0.033363f}, {0.080927f, 0.032114f}}},
+  // Ks 6h
+  {{{0.522756f, 0.038525f}, {0.329435f, 0.039824f}, {0.234224f, 0.037118f},
+    {0.179231f, 0.035059f}, {0.143224f, 0.033700f}, {0.117725f, 0.032401f},
+    {0.098830f, 0.031352f}, {0.084069f, 0.030333f}, {0.072638f, 0.029397f}}},
+  // Qs 6h
+  {{{0.490195f, 0.040591f}, {0.303895f, 0.039142f}, {0.214867f, 0.035797f},
+    {0.163245f, 0.033702f}, {0.129748f, 0.032193f}, {0.105735f, 0.030975f},
+    {0.088075f, 0.030159f}, {0.074604f, 0.029376f}, {0.063912f, 0.028703f}}},
+  // Js 6h
+  {{{0.457150f, 0.042394f}, {0.280075f, 0.037953f}, {0.197817f, 0.033938f},
+    {0.149694f, 0.031986f}, {0.118075f, 0.030982f}, {0.095902f, 0.030114f},
+    {0.079703f, 0.029507f}, {0.067458f, 0.029024f}, {0.057771f, 0.028693f}}},
+  // Ts 6h
+  {{{0.439324f, 0.044797f}, {0.274518f, 0.037370f}, {0.196980f, 0.033259f},
+    {0.150817f, 0.031365f}, {0.120159f, 0.030277f}, {0.098623f, 0.029583f},
+    {0.082763f, 0.029212f}, {0.070635f, 0.028924f}, {0.061131f, 0.028717f}}},
+  // 9s 6h
+  {{{0.421129f, 0.047834f}, {0.269469f, 0.036668f}, {0.196378f, 0.031821f},
+    {0.151751f, 0.029516f}, {0.121941f, 0.028069f}, {0.101344f, 0.026792f},
+    {0.086421f, 0.025903f}, {0.074984f, 0.025396f}, {0.066133f, 0.025052f}}},
+  // 8s 6h
+  {{{0.406763f, 0.050884f}, {0.267754f, 0.036118f}, {0.197724f, 0.031357f},
+    {0.154565f, 0.029176f}, {0.126012f, 0.027429f}, {0.106166f, 0.026165f},
+    {0.091935f, 0.025355f}, {0.080989f, 0.024832f}, {0.072505f, 0.024462f}}},
+  // 7s 6h
+  {{{0.396804f, 0.053473f}, {0.268474f, 0.035919f}, {0.200465f, 0.030872f},
+    {0.157754f, 0.028379f}, {0.129610f, 0.026673f}, {0.110170f, 0.025326f},
+    {0.096144f, 0.024480f}, {0.085474f, 0.024031f}, {0.076944f, 0.023826f}}},
+  // 6s 6h
+  {{{0.627790f, 0.011732f}, {0.428625f, 0.009519f}, {0.312533f, 0.008619f},
+    {0.242126f, 0.008332f}, {0.198525f, 0.008182f}, {0.170115f, 0.008159f},
+    {0.150897f, 0.008225f}, {0.137250f, 0.008274f}, {0.127097f, 0.008413f}}},
+  // 6s 5s
+  {{{0.404304f, 0.055937f}, {0.287897f, 0.035156f}, {0.224322f, 0.029917f},
+    {0.185245f, 0.027106f}, {0.159560f, 0.025267f}, {0.141541f, 0.023905f},
+    {0.128436f, 0.023024f}, {0.117917f, 0.022645f}, {0.109283f, 0.022350f}}},
+  // 6s 4s
+  {{{0.385412f, 0.057574f}, {0.270864f, 0.034883f}, {0.209472f, 0.029039f},
+    {0.172692f, 0.025800f}, {0.148851f, 0.023673f}, {0.132277f, 0.022167f},
+    {0.120090f, 0.021165f}, {0.110294f, 0.020719f}, {0.102236f, 0.020393f}}},
+  // 6s 3s
+  {{{0.367146f, 0.057242f}, {0.252454f, 0.033898f}, {0.192994f, 0.027538f},
+    {0.158356f, 0.024185f}, {0.136288f, 0.021889f}, {0.120787f, 0.020244f},
+    {0.109510f, 0.019218f}, {0.100325f, 0.018738f}, {0.092674f, 0.018436f}}},
+  // 6s 2s
+  {{{0.348356f, 0.057094f}, {0.234144f, 0.032957f}, {0.177014f, 0.026202f},
+    {0.144778f, 0.022582f}, {0.124252f, 0.020105f}, {0.109717f, 0.018510f},
+    {0.099146f, 0.017412f}, {0.090638f, 0.016775f}, {0.083448f, 0.016406f}}},
+  // As 5h
+  {{{0.556894f, 0.039094f}, {0.361187f, 0.043287f}, {0.259794f, 0.042078f},
+    {0.201181f, 0.040207f}, {0.162644f, 0.038727f}, {0.135277f, 0.037448f},
+    {0.114724f, 0.036265f}, {0.098662f, 0.035076f}, {0.086078f, 0.033627f}}},
+  // Ks 5h
+  {{{0.512376f, 0.041150f}, {0.319364f, 0.041733f}, {0.225324f, 0.038414f},
+    {0.171679f, 0.036142f}, {0.137220f, 0.034541f}, {0.112714f, 0.033164f},
+    {0.094440f, 0.032200f}, {0.080312f, 0.031070f}, {0.069372f, 0.029896f}}},
+  // Qs 5h
+  {{{0.479574f, 0.043085f}, {0.293890f, 0.040782f}, {0.206063f, 0.036813f},
+    {0.155989f, 0.034610f}, {0.123686f, 0.033108f}, {0.100879f, 0.031888f},
+    {0.084035f, 0.030892f}, {0.071223f, 0.029910f}, {0.061150f, 0.029041f}}},
+  // Js 5h
+  {{{0.448924f, 0.045246f}, {0.272872f, 0.040120f}, {0.191034f, 0.035710f},
+    {0.143906f, 0.033476f}, {0.113474f, 0.032251f}, {0.091833f, 0.031205f},
+    {0.076130f, 0.030448f}, {0.064259f, 0.029777f}, {0.055023f, 0.029114f}}},
+  // Ts 5h
+  {{{0.419185f, 0.047964f}, {0.253770f, 0.038965f}, {0.177668f, 0.034321f},
+    {0.133599f, 0.032412f}, {0.105008f, 0.031353f}, {0.085002f, 0.030698f},
+    {0.070304f, 0.030442f}, {0.059172f, 0.030144f}, {0.050610f, 0.029816f}}},
+  // 9s 5h
+  {{{0.401616f, 0.050606f}, {0.248833f, 0.037874f}, {0.176919f, 0.032360f},
+    {0.134459f, 0.029997f}, {0.106750f, 0.028471f}, {0.087484f, 0.027260f},
+    {0.073567f, 0.026414f}, {0.063156f, 0.025791f}, {0.055029f, 0.025311f}}},
+  // 8s 5h
+  {{{0.387626f, 0.053510f}, {0.247731f, 0.037220f}, {0.179281f, 0.031888f},
+    {0.138149f, 0.029481f}, {0.111585f, 0.027653f}, {0.093020f, 0.026441f},
+    {0.079726f, 0.025614f}, {0.069747f, 0.024861f}, {0.061947f, 0.024466f}}},
+  // 7s 5h
+  {{{0.377164f, 0.056862f}, {0.248800f, 0.036836f}, {0.182594f, 0.031434f},
+    {0.142526f, 0.028730f}, {0.116676f, 0.026931f}, {0.098936f, 0.025575f},
+    {0.086102f, 0.024845f}, {0.076377f, 0.024277f}, {0.068685f, 0.023928f}}},
+  // 6s 5h
+  {{{0.370965f, 0.058684f}, {0.251645f, 0.036351f}, {0.186451f, 0.030968f},
+    {0.146646f, 0.028188f}, {0.121219f, 0.026252f}, {0.103808f, 0.024895f},
+    {0.091176f, 0.024115f}, {0.081726f, 0.023597f}, {0.074194f, 0.023231f}}},
+  // 5s 5h
+  {{{0.596566f, 0.013705f}, {0.396670f, 0.010523f}, {0.285481f, 0.009221f},
+    {0.220957f, 0.008719f}, {0.182045f, 0.008481f}, {0.157390f, 0.008385f},
+    {0.140868f, 0.008475f}, {0.129180f, 0.008457f}, {0.120380f, 0.008478f}}},
+  // 5s 4s
+  {{{0.385921f, 0.058896f}, {0.275583f, 0.035178f}, {0.214788f, 0.029449f},
+    {0.178214f, 0.026347f}, {0.154642f, 0.024456f}, {0.138020f, 0.023316f},
+    {0.125637f, 0.022511f}, {0.115679f, 0.022199f}, {0.107370f, 0.022016f}}},
+  // 5s 3s
+  {{{0.367505f, 0.058985f}, {0.257700f, 0.034267f}, {0.199020f, 0.028037f},
+    {0.164950f, 0.024656f}, {0.143213f, 0.022582f}, {0.128023f, 0.021261f},
+    {0.116697f, 0.020435f}, {0.107460f, 0.020164f}, {0.099619f, 0.020015f}}},
+  // 5s 2s
+  {{{0.349006f, 0.058745f}, {0.239883f, 0.033343f}, {0.183811f, 0.026699f},
+    {0.151804f, 0.023096f}, {0.131513f, 0.020846f}, {0.117394f, 0.019449f},
+    {0.106808f, 0.018609f}, {0.098173f, 0.018129f}, {0.090881f, 0.017833f}}},
+  // As 4h
+  {{{0.547290f, 0.040036f}, {0.351428f, 0.043588f}, {0.251534f, 0.041917f},
+    {0.194637f, 0.039609f}, {0.157413f, 0.037877f}, {0.130888f, 0.036483f},
+    {0.111415f, 0.034994f}, {0.096151f, 0.033581f}, {0.084173f, 0.032037f}}},
+  // Ks 4h
+  {{{0.502336f, 0.041985f}, {0.309912f, 0.041803f}, {0.217558f, 0.038134f},
+    {0.165709f, 0.035218f}, {0.132262f, 0.033579f}, {0.108819f, 0.031966f},
+    {0.091539f, 0.030638f}, {0.078040f, 0.029465f}, {0.067562f, 0.028205f}}},
+  // Qs 4h
+  {{{0.469423f, 0.044195f}, {0.284729f, 0.040892f}, {0.198573f, 0.036351f},
+    {0.150138f, 0.033705f}, {0.119109f, 0.032001f}, {0.097304f, 0.030521f},
+    {0.081404f, 0.029288f}, {0.069251f, 0.028262f}, {0.059640f, 0.027267f}}},
+  // Js 4h
+  {{{0.438745f, 0.046442f}, {0.263653f, 0.040129f}, {0.183697f, 0.035050f},
+    {0.138419f, 0.032334f}, {0.108968f, 0.031029f}, {0.088337f, 0.029731f},
+    {0.073566f, 0.028678f}, {0.062445f, 0.027918f}, {0.053564f, 0.027302f}}},
+  // Ts 4h
+  {{{0.411378f, 0.049114f}, {0.246760f, 0.039272f}, {0.171657f, 0.034142f},
+    {0.128780f, 0.031945f}, {0.100891f, 0.030596f}, {0.081765f, 0.029654f},
+    {0.067932f, 0.028939f}, {0.057338f, 0.028500f}, {0.049080f, 0.028009f}}},
+  // 9s 4h
+  {{{0.381217f, 0.051837f}, {0.228551f, 0.037721f}, {0.158911f, 0.031726f},
+    {0.118816f, 0.029047f}, {0.092699f, 0.027581f}, {0.075015f, 0.026336f},
+    {0.062520f, 0.025316f}, {0.052949f, 0.024777f}, {0.045495f, 0.024384f}}},
+  // 8s 4h
+  {{{0.367355f, 0.054784f}, {0.226863f, 0.037088f}, {0.160602f, 0.031111f},
+    {0.121577f, 0.028341f}, {0.096479f, 0.026445f}, {0.079458f, 0.025004f},
+    {0.067569f, 0.023971f}, {0.058359f, 0.023221f}, {0.051134f, 0.022846f}}},
+  // 7s 4h
+  {{{0.357110f, 0.057933f}, {0.228672f, 0.036509f}, {0.164685f, 0.030295f},
+    {0.126811f, 0.027239f}, {0.102563f, 0.025361f}, {0.086286f, 0.023876f},
+    {0.074620f, 0.022891f}, {0.065676f, 0.022324f}, {0.058598f, 0.022015f}}},
+  // 6s 4h
+  {{{0.350444f, 0.060510f}, {0.231974f, 0.036199f}, {0.169681f, 0.030005f},
+    {0.132754f, 0.026858f}, {0.109247f, 0.024714f}, {0.093333f, 0.023233f},
+    {0.081863f, 0.022274f}, {0.073344f, 0.021757f}, {0.066403f, 0.021455f}}},
+  // 5s 4h
+  {{{0.350907f, 0.062085f}, {0.237417f, 0.036499f}, {0.175113f, 0.030519f},
+    {0.138446f, 0.027471f}, {0.115104f, 0.025557f}, {0.099301f, 0.024276f},
+    {0.087741f, 0.023626f}, {0.078824f, 0.023288f}, {0.071600f, 0.023048f}}},
+  // 4s 4h
+  {{{0.562793f, 0.015450f}, {0.363595f, 0.010815f}, {0.259955f, 0.008900f},
+    {0.203272f, 0.008031f}, {0.170483f, 0.007569f}, {0.150084f, 0.007273f},
+    {0.136425f, 0.007089f}, {0.126678f, 0.006921f}, {0.119089f, 0.006855f}}},
+  // 4s 3s
+  {{{0.357338f, 0.058778f}, {0.249702f, 0.033406f}, {0.192568f, 0.026467f},
+    {0.159461f, 0.022773f}, {0.138671f, 0.020556f}, {0.123928f, 0.019140f},
+    {0.113068f, 0.018191f}, {0.104090f, 0.017838f}, {0.096416f, 0.017610f}}},
+  // 4s 2s
+  {{{0.338313f, 0.058747f}, {0.232556f, 0.032285f}, {0.178131f, 0.025075f},
+    {0.147413f, 0.021082f}, {0.128120f, 0.018731f}, {0.114767f, 0.017281f},
+    {0.104627f, 0.016349f}, {0.096363f, 0.015793f}, {0.089218f, 0.015493f}}},
+  // As 3h
+  {{{0.538217f, 0.040013f}, {0.341452f, 0.043054f}, {0.243356f, 0.040869f},
+    {0.188095f, 0.038320f}, {0.152502f, 0.036048f}, {0.127173f, 0.034431f},
+    {0.108340f, 0.032777f}, {0.093695f, 0.031182f}, {0.082205f, 0.029503f}}},
+  // Ks 3h
+  {{{0.492944f, 0.041965f}, {0.300656f, 0.041155f}, {0.210348f, 0.036855f},
+    {0.160254f, 0.033831f}, {0.128326f, 0.031708f}, {0.105979f, 0.029896f},
+    {0.089454f, 0.028397f}, {0.076647f, 0.026983f}, {0.066740f, 0.025634f}}},
+  // Qs 3h
+  {{{0.460445f, 0.044050f}, {0.276215f, 0.040294f}, {0.191820f, 0.035162f},
+    {0.145121f, 0.032095f}, {0.115506f, 0.029882f}, {0.094761f, 0.028308f},
+    {0.079517f, 0.026956f}, {0.068006f, 0.025703f}, {0.058830f, 0.024647f}}},
+  // Js 3h
+  {{{0.429669f, 0.046126f}, {0.255160f, 0.039208f}, {0.176958f, 0.033556f},
+    {0.133527f, 0.030664f}, {0.105655f, 0.028981f}, {0.086112f, 0.027605f},
+    {0.071891f, 0.026534f}, {0.061187f, 0.025608f}, {0.052781f, 0.024949f}}},
+  // Ts 3h
+  {{{0.402214f, 0.048846f}, {0.238752f, 0.038538f}, {0.165408f, 0.032914f},
+    {0.124112f, 0.030320f}, {0.097841f, 0.028609f}, {0.079506f, 0.027521f},
+    {0.066295f, 0.026766f}, {0.056219f, 0.026091f}, {0.048278f, 0.025597f}}},
+  // 9s 3h
+  {{{0.374580f, 0.051905f}, {0.222192f, 0.037606f}, {0.153513f, 0.031094f},
+    {0.114702f, 0.028063f}, {0.089844f, 0.026097f}, {0.072815f, 0.024656f},
+    {0.060658f, 0.023466f}, {0.051548f, 0.022634f}, {0.044378f, 0.022107f}}},
+  // 8s 3h
+  {{{0.347503f, 0.054922f}, {0.207220f, 0.036484f}, {0.143308f, 0.030068f},
+    {0.106829f, 0.026997f}, {0.083773f, 0.025002f}, {0.068145f, 0.023748f},
+    {0.057144f, 0.022773f}, {0.048764f, 0.022047f}, {0.042198f, 0.021699f}}},
+  // 7s 3h
+  {{{0.337221f, 0.058060f}, {0.208900f, 0.035725f}, {0.147009f, 0.028991f},
+    {0.111270f, 0.025618f}, {0.088923f, 0.023441f}, {0.073825f, 0.022033f},
+    {0.063095f, 0.021008f}, {0.054890f, 0.020360f}, {0.048318f, 0.019960f}}},
+  // 6s 3h
+  {{{0.330836f, 0.060492f}, {0.212982f, 0.035110f}, {0.152506f, 0.028299f},
+    {0.117406f, 0.024827f}, {0.095677f, 0.022622f}, {0.081038f, 0.021106f},
+    {0.070479f, 0.020060f}, {0.062529f, 0.019488f}, {0.056204f, 0.019164f}}},
+  // 5s 3h
+  {{{0.330732f, 0.062389f}, {0.218533f, 0.035590f}, {0.158651f, 0.028822f},
+    {0.124281f, 0.025448f}, {0.103198f, 0.023246f}, {0.088938f, 0.021908f},
+    {0.078380f, 0.021257f}, {0.070263f, 0.020862f}, {0.063765f, 0.020578f}}},
+  // 4s 3h
+  {{{0.320404f, 0.062187f}, {0.210601f, 0.034611f}, {0.152245f, 0.027422f},
+    {0.118887f, 0.023778f}, {0.098427f, 0.021475f}, {0.084563f, 0.020187f},
+    {0.074683f, 0.019147f}, {0.066944f, 0.018575f}, {0.060626f, 0.018338f}}},
+  // 3s 3h
+  {{{0.528757f, 0.017148f}, {0.332306f, 0.011107f}, {0.237067f, 0.008449f},
+    {0.188004f, 0.007144f}, {0.160908f, 0.006299f}, {0.144482f, 0.005755f},
+    {0.133278f, 0.005431f}, {0.125056f, 0.005126f}, {0.118444f, 0.004908f}}},
+  // 3s 2s
+  {{{0.330199f, 0.058380f}, {0.224183f, 0.031465f}, {0.170951f, 0.023619f},
+    {0.141449f, 0.019376f}, {0.123132f, 0.016738f}, {0.110405f, 0.015099f},
+    {0.100737f, 0.014202f}, {0.092710f, 0.013598f}, {0.085795f, 0.013202f}}},
+  // As 2h
+  {{{0.529141f, 0.039870f}, {0.331994f, 0.042522f}, {0.235269f, 0.039893f},
+    {0.181112f, 0.037004f}, {0.146785f, 0.034537f}, {0.122301f, 0.032625f},
+    {0.104290f, 0.030804f}, {0.090185f, 0.029101f}, {0.079235f, 0.027283f}}},
+  // Ks 2h
+  {{{0.483847f, 0.041637f}, {0.291980f, 0.040445f}, {0.203655f, 0.035811f},
+    {0.155121f, 0.032460f}, {0.124497f, 0.030172f}, {0.103096f, 0.028152f},
+    {0.087451f, 0.026611f}, {0.075222f, 0.025110f}, {0.065814f, 0.023611f}}},
+  // Qs 2h
+  {{{0.451268f, 0.043752f}, {0.267664f, 0.039469f}, {0.185210f, 0.034080f},
+    {0.140152f, 0.030585f}, {0.111824f, 0.028189f}, {0.092132f, 0.026346f},
+    {0.077799f, 0.024911f}, {0.066872f, 0.023626f}, {0.058251f, 0.022312f}}},
+  // Js 2h
+  {{{0.420662f, 0.045899f}, {0.247252f, 0.038389f}, {0.170815f, 0.032451f},
+    {0.128644f, 0.029227f}, {0.101899f, 0.027321f}, {0.083307f, 0.025709f},
+    {0.069862f, 0.024569f}, {0.059785f, 0.023454f}, {0.051867f, 0.022591f}}},
+  // Ts 2h
+  {{{0.393419f, 0.048775f}, {0.230695f, 0.037765f}, {0.159096f, 0.031780f},
+    {0.119489f, 0.028830f}, {0.094311f, 0.026961f}, {0.077095f, 0.025637f},
+    {0.064612f, 0.024827f}, {0.055013f, 0.024107f}, {0.047498f, 0.023437f}}},
+  // 9s 2h
+  {{{0.365489f, 0.051848f}, {0.214450f, 0.036774f}, {0.147762f, 0.029935f},
+    {0.110464f, 0.026594f}, {0.086684f, 0.024443f}, {0.070679f, 0.022705f},
+    {0.059147f, 0.021498f}, {0.050580f, 0.020572f}, {0.043800f, 0.019858f}}},
+  // 8s 2h
+  {{{0.341119f, 0.054895f}, {0.201152f, 0.035943f}, {0.138403f, 0.029270f},
+    {0.102857f, 0.026058f}, {0.080655f, 0.023848f}, {0.065827f, 0.022168f},
+    {0.055230f, 0.021061f}, {0.047309f, 0.020073f}, {0.041102f, 0.019459f}}},
+  // 7s 2h
+  {{{0.317204f, 0.057821f}, {0.189428f, 0.034968f}, {0.130081f, 0.027926f},
+    {0.097005f, 0.024456f}, {0.076473f, 0.022303f}, {0.062766f, 0.020821f},
+    {0.052964f, 0.019935f}, {0.045520f, 0.019306f}, {0.039591f, 0.018849f}}},
+  // 6s 2h
+  {{{0.311272f, 0.060412f}, {0.193136f, 0.034448f}, {0.135102f, 0.027063f},
+    {0.102324f, 0.023407f}, {0.082184f, 0.020987f}, {0.068811f, 0.019344f},
+    {0.059259f, 0.018328f}, {0.052049f, 0.017739f}, {0.046189f, 0.017300f}}},
+  // 5s 2h
+  {{{0.311895f, 0.062181f}, {0.199664f, 0.034715f}, {0.142195f, 0.027643f},
+    {0.109899f, 0.024143f}, {0.090419f, 0.021740f}, {0.077373f, 0.020275f},
+    {0.067791f, 0.019494f}, {0.060342f, 0.019095f}, {0.054370f, 0.018664f}}},
+  // 4s 2h
+  {{{0.301129f, 0.062199f}, {0.192361f, 0.033704f}, {0.136754f, 0.026048f},
+    {0.105813f, 0.022241f}, {0.087235f, 0.019845f}, {0.074895f, 0.018306f},
+    {0.065909f, 0.017263f}, {0.058971f, 0.016731f}, {0.053199f, 0.016370f}}},
+  // 3s 2h
+  {{{0.291876f, 0.061799f}, {0.183109f, 0.032553f}, {0.128964f, 0.024607f},
+    {0.099765f, 0.020214f}, {0.082256f, 0.017453f}, {0.070527f, 0.015790f},
+    {0.061989f, 0.014755f}, {0.055184f, 0.014193f}, {0.049637f, 0.013772f}}},
+  // 2s 2h
+  {{{0.493327f, 0.019190f}, {0.301850f, 0.011787f}, {0.216331f, 0.008430f},
+    {0.174972f, 0.006629f}, {0.153040f, 0.005434f}, {0.139888f, 0.004625f},
+    {0.131011f, 0.004077f}, {0.124091f, 0.003544f}, {0.118216f, 0.003139f}}},
+}};
+
+#endif // PREFLOP_TABLE_DATA_H_
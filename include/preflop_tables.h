@@ -0,0 +1,38 @@
+#ifndef PREFLOP_TABLES_H_
+#define PREFLOP_TABLES_H_
+
+#include "preflop_table_data.h"
+#include "types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+/**
+ * Starting hand class of two hole cards, numbered as the cells of a 13x13
+ * grid read row by row: pairs on the diagonal, suited hands above it and
+ * offsuit hands below, aces first.
+ */
+constexpr size_t starting_hand_class(uint32_t card1, uint32_t card2) {
+  size_t row = 12 - ((card1 >> 8) & 0xf);
+  size_t col = 12 - ((card2 >> 8) & 0xf);
+  bool suited = (card1 & card2 & 0xf000) != 0;
+  if ((row < col) != suited) {
+    std::swap(row, col);
+  }
+  return row * 13 + col;
+}
+
+/**
+ * Equity of a starting hand against `num_opponents` players holding random
+ * hands, before the flop and without dead cards.
+ */
+constexpr std::optional<EvalResult> preflop_vs_random(uint32_t card1, uint32_t card2, size_t num_opponents) {
+  if (num_opponents == 0 || num_opponents > MAX_TABLE_OPPONENTS) {
+    return std::nullopt;
+  }
+  return PREFLOP_VS_RANDOM[starting_hand_class(card1, card2)][num_opponents - 1];
+}
+
+#endif // PREFLOP_TABLES_H_
@@ -2,26 +2,125 @@
 #define RANGE_EVALUATION_H_
 
 #include "types.h"
+#include "card_index.h"
 #include "hand_range.hpp"
 #include "evaluation.hpp"
 
 #include <cstdint>
+#include <optional>
+#include <utility>
 #include <vector>
 
+/**
+ * Villain weight won, tied and faced by one hero combo, summed over the
+ * runouts of the board. Totals are linear in the villain weights: the totals
+ * against two ranges add up to the totals against their union.
+ */
+struct ComboTotals {
+  double win;
+  double tie;
+  double total;
+};
+
 class RangeEvaluator {
 public:
 
-  RangeEvaluator();
+  explicit RangeEvaluator(uint64_t seed = Evaluator::DEFAULT_SEED);
+
+  void set_seed(uint64_t seed) {
+    m_evaluator.set_seed(seed);
+    m_cache_valid = false;
+  }
+  void set_num_simulations(size_t n);
 
+  /**
+   * Equity of `hand` against `range`: the weighted average of its equity
+   * against each combo. Exact from the flop on.
+   *
+   * The equity against each combo is cached for the current hand and board,
+   * and the weighted sums are kept for the range last evaluated. Evaluating
+   * that range again after some `addHand`, `setWeight` or `removeHand` calls
+   * only evaluates the new combos and adjusts the sums for each change.
+   */
   EvalResult evaluate(const std::pair<uint32_t, uint32_t>& hand, const HandRange& range);
 
+  /**
+   * Exact equity of every combo of `hero` against the whole of `villain` on a
+   * flop, turn or river board, in the order of `hero.hands()`. Combos blocked
+   * by the board or the dead cards get {0, 0}.
+   *
+   * Every combo is ranked once per runout and the combos are sorted by
+   * strength; wins and ties are then read off cumulative villain weights,
+   * minus the weight of the villain combos sharing a card with the hero
+   * combo. This is O(N log N) per runout instead of O(N^2) comparisons.
+   */
+  std::vector<EvalResult> evaluate(const HandRange& hero, const HandRange& villain);
+
+  /**
+   * Totals behind `evaluate(hero, villain)`, in the order of `hero.hands()`.
+   * The reference is valid until the next query.
+   */
+  const std::vector<ComboTotals>& totals(const HandRange& hero, const HandRange& villain);
+
   template <typename InputIterator>
   void set_board(InputIterator begin, InputIterator end) {
-    m_evaluator.set_board(begin, end);
+    m_situation.board = {begin, end};
+    m_cache_valid = false;
+  }
+
+  /**
+   * Cards known to be out of play: they are never dealt to the board, and
+   * combos holding them are left out of both ranges.
+   */
+  template <typename InputIterator>
+  void set_dead_cards(InputIterator begin, InputIterator end) {
+    m_situation.dead = CardSet(begin, end);
+    m_cache_valid = false;
   }
 
 private:
+  struct RankedCombo {
+    uint16_t rank;
+    CardIndex first;
+    CardIndex second;
+    float weight;
+    uint32_t index;
+  };
+
+  // Fill m_totals with the weights won, tied and faced by each hero combo
+  void sweep(const WeightedHand* hero, size_t num_hero, const HandRange& villain);
+
+  // Sums over the whole range, evaluating the combos not cached yet
+  void rebuild_sums(const HandRange& range);
+  // Add `weight` times the equity against `combo`, unless it is blocked
+  void add_to_sums(const std::pair<uint32_t, uint32_t>& combo, double weight);
+  const EvalResult& combo_result(const std::pair<uint32_t, uint32_t>& combo);
+
   Evaluator m_evaluator;
+  Situation m_situation;
+  EvalScratch m_scratch;
+
+  std::vector<RankedCombo> m_hero_combos;
+  std::vector<RankedCombo> m_villain_combos;
+  std::vector<ComboTotals> m_totals;
+  // Villain weight by pair of card indices, for the combo equal to the hero's
+  std::vector<float> m_pair_weight;
+
+  // Equity of m_cached_hand against each combo, by pair of card indices. Valid
+  // until the hand, board, dead cards or simulation settings change.
+  bool m_cache_valid{false};
+  std::pair<uint32_t, uint32_t> m_cached_hand{0, 0};
+  std::vector<std::optional<EvalResult>> m_combo_results;
+  HandRange m_cached_hand_range;
+  std::vector<WeightedHand> m_missing;
+
+  // Weighted sums over the range of epoch m_range_epoch, up to its change
+  // m_changes_seen
+  uint64_t m_range_epoch{0};
+  size_t m_changes_seen{0};
+  double m_weight_sum{0};
+  double m_win_sum{0};
+  double m_tie_sum{0};
 };
 
 #endif // RANGE_EVALUATION_H_
@@ -0,0 +1,109 @@
+#ifndef RANK_TABLE_H_
+#define RANK_TABLE_H_
+
+#include "card_index.h"
+#include "combinations.h"
+#include "stats.h"
+#include "table_buffer.h"
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * The rank of every 7-card hand, precomputed: 133784560 ranks of 2 bytes,
+ * about 267MB, in colex order of the hands' card indices (see
+ * `Combinations`).
+ *
+ * The file is memory-mapped, so a table is ready as soon as it is loaded,
+ * and ranking a hand takes its index, computed from the cards without
+ * sorting them, and a single load. Pages are read in from the file on their
+ * first access only. Ranks are stored in native byte order.
+ *
+ * A table may hold only the hands of the first cards (by index), so that
+ * small ones can be generated for tests.
+ */
+class RankTable {
+public:
+  static constexpr uint64_t NUM_HANDS = binomial(52, 7);
+
+  struct GenerateOptions {
+    // Cards dealt from, the card indices below it
+    size_t num_cards{52};
+    size_t num_threads{1};
+
+    // Called after each chunk of hands written, from the calling thread
+    std::function<void(uint64_t done, uint64_t total)> progress;
+  };
+
+  /**
+   * Rank every hand and write the table to `path`. Ranks are computed card
+   * by card with the split evaluator and checked against `eval7`, so that
+   * the table cannot disagree with it. Throws std::invalid_argument for
+   * invalid options, and std::runtime_error on I/O errors or if the two
+   * evaluators disagree.
+   */
+  static void generate(const std::string& path, const GenerateOptions& options);
+
+  /**
+   * Map a table written by `generate`. Throws std::runtime_error if the file
+   * cannot be mapped or is not a rank table.
+   */
+  static RankTable load(const std::string& path);
+
+  /**
+   * Position of a hand in the table: the sum of binomial(c_i, i + 1) over
+   * its cards in increasing order, which the set bits of the hand's card
+   * mask give in that order. The cards must be distinct.
+   */
+  static uint64_t index(const std::array<CardIndex, 7>& hand) {
+    uint64_t cards = 0;
+    for (CardIndex card : hand) {
+      cards |= uint64_t(1) << card;
+    }
+    assert(std::popcount(cards) == 7);
+
+    uint64_t index = 0;
+    for (size_t i = 1; i <= 7; ++i) {
+      index += BINOMIALS[std::countr_zero(cards)][i];
+      cards &= cards - 1;
+    }
+    return index;
+  }
+
+  // Cards the table deals from, and number of hands it holds
+  size_t num_cards() const { return m_num_cards; }
+  uint64_t size() const { return m_size; }
+
+  uint16_t at(uint64_t index) const {
+    assert(index < m_size);
+    return m_ranks[index];
+  }
+
+  /**
+   * Rank of a hand of distinct cards, all below `num_cards()`, as `eval7`
+   * gives it.
+   */
+  uint16_t eval7(const std::array<CardIndex, 7>& hand) const {
+    STATS_ADD(EVAL7, 1);
+    return at(index(hand));
+  }
+
+  uint16_t operator()(const std::array<uint32_t, 7>& hand) const {
+    return eval7(to_indices(hand));
+  }
+
+private:
+  RankTable() = default;
+
+  MappedFile m_file;
+  const uint16_t* m_ranks{nullptr};
+  size_t m_num_cards{0};
+  uint64_t m_size{0};
+};
+
+#endif // RANK_TABLE_H_
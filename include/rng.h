@@ -0,0 +1,88 @@
+#ifndef RNG_H_
+#define RNG_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * Philox4x32-10 counter-based random number generator.
+ *
+ * See Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC11).
+ * The output is a pure function of (seed, stream, position), so any stream
+ * can be reproduced or split across threads without shared state. Unlike
+ * std::mt19937 combined with the standard distributions, the values drawn
+ * are identical on every platform.
+ */
+class Philox4x32 {
+public:
+  using result_type = uint32_t;
+
+  explicit Philox4x32(uint64_t seed, uint64_t stream = 0)
+    : m_key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)},
+      m_counter{0, 0, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)} {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()() {
+    if (m_index == 4) {
+      m_block = generate_block();
+      m_index = 0;
+    }
+    return m_block[m_index++];
+  }
+
+  /**
+   * Uniform integer in [0, n), using Lemire's multiply-and-reject method.
+   */
+  uint32_t bounded(uint32_t n) {
+    uint64_t m = uint64_t((*this)()) * n;
+    uint32_t low = static_cast<uint32_t>(m);
+    if (low < n) {
+      uint32_t threshold = -n % n;
+      while (low < threshold) {
+        m = uint64_t((*this)()) * n;
+        low = static_cast<uint32_t>(m);
+      }
+    }
+    return static_cast<uint32_t>(m >> 32);
+  }
+
+private:
+  static constexpr uint32_t M0 = 0xD2511F53;
+  static constexpr uint32_t M1 = 0xCD9E8D57;
+  static constexpr uint32_t W0 = 0x9E3779B9;
+  static constexpr uint32_t W1 = 0xBB67AE85;
+
+  std::array<uint32_t, 2> m_key;
+  std::array<uint32_t, 4> m_counter;
+  std::array<uint32_t, 4> m_block{};
+  int m_index{4};
+
+  std::array<uint32_t, 4> generate_block() {
+    std::array<uint32_t, 4> x = m_counter;
+    std::array<uint32_t, 2> key = m_key;
+
+    for (int round = 0; round < 10; ++round) {
+      uint64_t p0 = uint64_t(M0) * x[0];
+      uint64_t p1 = uint64_t(M1) * x[2];
+      x = {
+        static_cast<uint32_t>(p1 >> 32) ^ x[1] ^ key[0],
+        static_cast<uint32_t>(p1),
+        static_cast<uint32_t>(p0 >> 32) ^ x[3] ^ key[1],
+        static_cast<uint32_t>(p0)
+      };
+      key[0] += W0;
+      key[1] += W1;
+    }
+
+    // Advance the 64-bit block counter held in the first two words
+    if (++m_counter[0] == 0) {
+      ++m_counter[1];
+    }
+    return x;
+  }
+};
+
+#endif // RNG_H_
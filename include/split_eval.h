@@ -0,0 +1,105 @@
+#ifndef SPLIT_EVAL_H_
+#define SPLIT_EVAL_H_
+
+#include "bitset_rankindex.h"
+#include "stats.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Rank keys whose sums identify every multiset of 7 ranks (at most 4 of a
+ * kind) uniquely, largest sum 7825759. Deuce first, as in the card encoding.
+ */
+constexpr std::array<uint32_t, 13> RANK_KEYS = {
+  0, 1, 5, 22, 98, 453, 2031, 8698, 22854, 83661, 262349, 636345, 1479181
+};
+
+/**
+ * Suit and rank summary of a set of cards.
+ *
+ * All fields are accumulated card by card, and summaries of disjoint sets of
+ * cards add up, so the summary of a board can be computed once and completed
+ * with each player's hole cards.
+ *
+ *   rank_key    = sum of RANK_KEYS over the cards
+ *   suit_counts = 4 bits per suit (spades lowest) counting its cards
+ *   suit_ranks  = rank bits held in each suit
+ */
+struct HandSummary {
+  uint32_t rank_key{0};
+  uint32_t suit_counts{0};
+  std::array<uint16_t, 4> suit_ranks{};
+
+  void add(uint32_t card) {
+    int suit = std::countr_zero((card >> 12) & 0xf);
+    rank_key += RANK_KEYS[(card >> 8) & 0xf];
+    suit_counts += 1u << (4 * suit);
+    suit_ranks[suit] |= static_cast<uint16_t>(card >> 16);
+  }
+
+  HandSummary operator+(const HandSummary& other) const {
+    return {
+      rank_key + other.rank_key,
+      suit_counts + other.suit_counts,
+      {
+        static_cast<uint16_t>(suit_ranks[0] | other.suit_ranks[0]),
+        static_cast<uint16_t>(suit_ranks[1] | other.suit_ranks[1]),
+        static_cast<uint16_t>(suit_ranks[2] | other.suit_ranks[2]),
+        static_cast<uint16_t>(suit_ranks[3] | other.suit_ranks[3])
+      }
+    };
+  }
+};
+
+/**
+ * 7-card evaluator that looks at suits and ranks separately.
+ *
+ * A 7-card hand holds a flush only if one suit has 5 cards or more, which is
+ * read off the suit counts. Flushes are then ranked from the 13-bit rank mask
+ * of that suit, and every other hand from its rank multiset, each with a
+ * single table lookup. Gives the same ranks as `eval7`.
+ */
+class SplitEvaluator {
+public:
+  SplitEvaluator();
+
+  uint16_t eval(const HandSummary& summary) const {
+    STATS_ADD(EVAL7, 1);
+    // Add 3 to every suit count: bit 3 of a count is then set when it reaches 5
+    if (uint32_t flush = (summary.suit_counts + 0x3333) & 0x8888) {
+      return m_flush[summary.suit_ranks[std::countr_zero(flush) / 4]];
+    }
+    return m_values[m_rank_index(summary.rank_key)];
+  }
+
+  uint16_t eval7(const std::array<uint32_t, 7>& hand) const {
+    HandSummary summary;
+    for (uint32_t card : hand) {
+      summary.add(card);
+    }
+    return eval(summary);
+  }
+
+  uint16_t operator()(const std::array<uint32_t, 7>& hand) const {
+    return eval7(hand);
+  }
+
+private:
+  // Best flush among the 5-card subsets of a rank mask
+  std::array<uint16_t, 8192> m_flush;
+
+  // Best non-flush hand of a rank multiset, indexed by the rank of its key
+  BitsetRankIndex m_rank_index;
+  std::vector<uint16_t> m_values;
+};
+
+/**
+ * Shared evaluator, built on first use. Must not be called during static
+ * initialization.
+ */
+const SplitEvaluator& split_evaluator();
+
+#endif // SPLIT_EVAL_H_
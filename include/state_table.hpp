@@ -0,0 +1,91 @@
+#ifndef STATE_TABLE_H_
+#define STATE_TABLE_H_
+
+#include "card_index.h"
+#include "stats.h"
+#include "table_buffer.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Card-by-card transition table for 7-card hands, in the spirit of the
+ * "Two Plus Two" evaluator.
+ *
+ * A state summarizes the cards seen so far: how many cards of each rank,
+ * and the ranks held in every suit that can still make a flush. Entry
+ * `state + card` of the table is the offset of the next state, or, once
+ * seven cards have been seen, the hand rank. Evaluating a hand is therefore
+ * seven dependent loads, at the cost of a table of about 128MB.
+ *
+ * Ranks are the same as `eval7`'s. The table is either built in memory, in
+ * a `TableBuffer` so it can use huge pages, or memory-mapped from a file
+ * written by `save`.
+ */
+class StateTable {
+public:
+  /**
+   * Build the table in memory. This takes a few seconds.
+   */
+  static StateTable build();
+
+  /**
+   * Map a table written by `save`. Throws std::runtime_error if the file
+   * cannot be mapped or is not a state table.
+   */
+  static StateTable load(const std::string& path);
+
+  /**
+   * Write the table to `path`. Throws std::runtime_error on I/O errors.
+   */
+  void save(const std::string& path) const;
+
+  // Moving a buffer or a mapping keeps its memory, so m_table stays valid
+  StateTable(StateTable&& other) noexcept = default;
+  StateTable& operator=(StateTable&& other) noexcept = default;
+  StateTable(const StateTable&) = delete;
+  StateTable& operator=(const StateTable&) = delete;
+
+  /**
+   * State after adding `card` to `state` (0 before any card). Cards can be
+   * added in any order; after the 7th card the state is the hand rank.
+   */
+  uint32_t next(uint32_t state, CardIndex card) const {
+    return m_table[state + card];
+  }
+
+  uint16_t eval7(const std::array<CardIndex, 7>& hand) const {
+    STATS_ADD(EVAL7, 1);
+    uint32_t p = 0;
+    for (CardIndex card : hand) {
+      p = m_table[p + card];
+    }
+    return static_cast<uint16_t>(p);
+  }
+
+  uint16_t operator()(const std::array<uint32_t, 7>& hand) const {
+    STATS_ADD(EVAL7, 1);
+    uint32_t p = 0;
+    for (uint32_t card : hand) {
+      p = m_table[p + card_index(card)];
+    }
+    return static_cast<uint16_t>(p);
+  }
+
+  size_t num_states() const { return m_size / 52; }
+  size_t size_bytes() const { return m_size * sizeof(uint32_t); }
+
+private:
+  StateTable() = default;
+
+  // One of the two holds the table: built in memory, or loaded from a file
+  TableBuffer m_storage;
+  MappedFile m_file;
+  const uint32_t* m_table{nullptr};
+  size_t m_size{0};
+};
+
+#endif // STATE_TABLE_H_
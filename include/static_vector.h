@@ -0,0 +1,78 @@
+#ifndef STATIC_VECTOR_H_
+#define STATIC_VECTOR_H_
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+
+/**
+ * Vector with a fixed capacity stored inline, so it never touches the heap.
+ */
+template <typename T, size_t N>
+class StaticVector {
+public:
+  StaticVector() = default;
+
+  StaticVector(std::initializer_list<T> values) {
+    for (const auto& value : values) {
+      push_back(value);
+    }
+  }
+
+  template <typename InputIterator>
+  StaticVector(InputIterator begin, InputIterator end) {
+    for (auto it = begin; it != end; ++it) {
+      push_back(*it);
+    }
+  }
+
+  void push_back(const T& value) {
+    assert(m_size < N && "StaticVector capacity exceeded");
+    m_data[m_size++] = value;
+  }
+
+  void pop_back() {
+    assert(m_size > 0);
+    --m_size;
+  }
+
+  void resize(size_t size) {
+    assert(size <= N && "StaticVector capacity exceeded");
+    m_size = size;
+  }
+
+  void clear() { m_size = 0; }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  static constexpr size_t capacity() { return N; }
+
+  T& operator[](size_t i) { return m_data[i]; }
+  const T& operator[](size_t i) const { return m_data[i]; }
+
+  T& back() { return m_data[m_size - 1]; }
+  const T& back() const { return m_data[m_size - 1]; }
+
+  T* data() { return m_data.data(); }
+  const T* data() const { return m_data.data(); }
+
+  T* begin() { return m_data.data(); }
+  T* end() { return m_data.data() + m_size; }
+  const T* begin() const { return m_data.data(); }
+  const T* end() const { return m_data.data() + m_size; }
+
+  friend bool operator==(const StaticVector& lhs, const StaticVector& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      if (!(lhs[i] == rhs[i])) return false;
+    }
+    return true;
+  }
+
+private:
+  std::array<T, N> m_data{};
+  size_t m_size{0};
+};
+
+#endif // STATIC_VECTOR_H_
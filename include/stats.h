@@ -0,0 +1,119 @@
+#ifndef STATS_H_
+#define STATS_H_
+
+#include <cstdint>
+
+/**
+ * Opt-in instrumentation of the evaluation hot paths.
+ *
+ * When built with HOLDEM_STATS defined (CMake option ENABLE_STATS), the
+ * evaluators count their calls and the lookup path each 5-card hand takes,
+ * and queries time their setup, simulation and reduction phases. Counts are
+ * kept per thread and summed by `eval_stats`. Building the evaluators'
+ * lookup tables (`split_evaluator()` on first use, `StateTable::build`) is
+ * not counted, though a query that triggers it still includes it in its
+ * timings. Without HOLDEM_STATS the STATS_* macros expand to nothing and
+ * `eval_stats` returns zeros.
+ */
+struct EvalStats {
+  uint64_t eval5_calls;
+  uint64_t flush_hits;      // eval5 answered by flush_table
+  uint64_t unique5_hits;    // eval5 answered by unique5 (straights, high cards)
+  uint64_t hash_hits;       // eval5 answered by the perfect hash
+  uint64_t eval7_calls;     // 7-card hands ranked, by any evaluator
+  uint64_t simulations;     // runouts simulated or enumerated
+  uint64_t deck_rebuilds;
+  double setup_seconds;
+  double simulate_seconds;
+  double reduce_seconds;
+};
+
+#ifdef HOLDEM_STATS
+constexpr bool eval_stats_enabled = true;
+#else
+constexpr bool eval_stats_enabled = false;
+#endif
+
+EvalStats eval_stats();
+
+/**
+ * Zero the counters. Must not race with queries.
+ */
+void reset_eval_stats();
+
+#ifdef HOLDEM_STATS
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace stats {
+  enum Counter : size_t {
+    EVAL5, FLUSH, UNIQUE5, HASH, EVAL7, SIMULATIONS, DECK_REBUILDS,
+    SETUP_NS, SIMULATE_NS, REDUCE_NS, NUM_COUNTERS
+  };
+
+  /**
+   * Counters of one thread. Only that thread writes them, so increments need
+   * no atomic read-modify-write; they are atomic only to be read safely.
+   */
+  struct ThreadCounters {
+    std::array<std::atomic<uint64_t>, NUM_COUNTERS> values{};
+    // Nesting depth of the `Pause` scopes; nothing is counted while nonzero
+    int paused{0};
+
+    ThreadCounters();
+    ~ThreadCounters();
+  };
+
+  inline ThreadCounters& thread_counters() {
+    thread_local ThreadCounters counters;
+    return counters;
+  }
+
+  inline void add(Counter counter, uint64_t n) {
+    auto& counters = thread_counters();
+    if (counters.paused) return;
+    auto& value = counters.values[counter];
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  // Stops counting on this thread for its lifetime, e.g. while building tables
+  class Pause {
+  public:
+    Pause() { ++thread_counters().paused; }
+    ~Pause() { --thread_counters().paused; }
+    Pause(const Pause&) = delete;
+    Pause& operator=(const Pause&) = delete;
+  };
+
+  class ScopedTimer {
+  public:
+    explicit ScopedTimer(Counter counter)
+      : m_counter{counter}, m_start{std::chrono::steady_clock::now()} {}
+
+    ~ScopedTimer() {
+      auto elapsed = std::chrono::steady_clock::now() - m_start;
+      add(m_counter, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+  private:
+    Counter m_counter;
+    std::chrono::steady_clock::time_point m_start;
+  };
+}
+
+#define STATS_ADD(counter, n) ::stats::add(::stats::counter, (n))
+#define STATS_TIME(counter) ::stats::ScopedTimer stats_timer_##counter{::stats::counter}
+#define STATS_PAUSE() ::stats::Pause stats_pause
+
+#else
+
+#define STATS_ADD(counter, n) ((void)0)
+#define STATS_TIME(counter) ((void)0)
+#define STATS_PAUSE() ((void)0)
+
+#endif // HOLDEM_STATS
+
+#endif // STATS_H_
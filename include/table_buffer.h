@@ -0,0 +1,132 @@
+#ifndef TABLE_BUFFER_H_
+#define TABLE_BUFFER_H_
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Zero-filled storage for large lookup tables, aligned to a cache line.
+ *
+ * Lookups into tables of several megabytes land on random pages, so with 4KB
+ * pages nearly every one of them also misses the TLB. Buffers of 2MB and more
+ * are therefore mapped anonymously and asked to be backed by huge pages:
+ *
+ *   - with HOLDEM_HUGETLB=1 in the environment, explicit huge pages
+ *     (MAP_HUGETLB) are tried first. These must have been reserved, e.g.
+ *     through /proc/sys/vm/nr_hugepages, and the mapping silently falls back
+ *     to normal pages when none are left;
+ *   - otherwise transparent huge pages are requested with madvise, which the
+ *     kernel honours when THP is set to "madvise" or "always".
+ *
+ * Smaller buffers come from the heap.
+ */
+class TableBuffer {
+public:
+  static constexpr size_t ALIGNMENT = 64;
+  static constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+  TableBuffer() = default;
+  explicit TableBuffer(size_t bytes);
+
+  TableBuffer(TableBuffer&& other) noexcept;
+  TableBuffer& operator=(TableBuffer&& other) noexcept;
+  TableBuffer(const TableBuffer&) = delete;
+  TableBuffer& operator=(const TableBuffer&) = delete;
+  ~TableBuffer();
+
+  template <typename T>
+  T* as() { return static_cast<T*>(m_data); }
+
+  template <typename T>
+  const T* as() const { return static_cast<const T*>(m_data); }
+
+  size_t size() const { return m_size; }
+
+  /**
+   * Whether the buffer is backed by explicit huge pages. Transparent huge
+   * pages are granted by the kernel behind our back and are not reported.
+   */
+  bool hugetlb() const { return m_hugetlb; }
+
+private:
+  void release();
+
+  void* m_data{nullptr};
+  size_t m_size{0};
+
+  // Set when the buffer is mapped rather than allocated
+  size_t m_mapping_size{0};
+  bool m_hugetlb{false};
+};
+
+/**
+ * Read-only mapping of a whole file, for tables generated ahead of time.
+ * Pages are read in from the file on their first access only.
+ */
+class MappedFile {
+public:
+  MappedFile() = default;
+
+  /**
+   * Map the file at `path`; an empty file maps to nothing. Throws
+   * std::runtime_error naming `what` (e.g. "flop database") if the file
+   * cannot be opened or mapped.
+   */
+  MappedFile(const std::string& path, const std::string& what);
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  template <typename T>
+  const T* as(size_t offset = 0) const {
+    return reinterpret_cast<const T*>(static_cast<const char*>(m_data) + offset);
+  }
+
+  size_t size() const { return m_size; }
+
+  // Disable read-ahead, for tables read at random places
+  void advise_random() const;
+
+private:
+  void release();
+
+  void* m_data{nullptr};
+  size_t m_size{0};
+};
+
+/**
+ * File written piece by piece at given offsets, from any number of threads.
+ * Errors throw std::runtime_error naming `what`.
+ */
+class FileWriter {
+public:
+  /**
+   * Open or create the file at `path`, emptied if `truncate` is set.
+   */
+  FileWriter(const std::string& path, const std::string& what, bool truncate);
+
+  FileWriter(const FileWriter&) = delete;
+  FileWriter& operator=(const FileWriter&) = delete;
+  ~FileWriter();
+
+  size_t size() const;
+  void resize(size_t size);
+
+  void read_at(void* data, size_t size, size_t offset) const;
+  void write_at(const void* data, size_t size, size_t offset);
+
+  // Flush the data written so far to disk
+  void sync();
+
+private:
+  [[noreturn]] void fail(const char* action) const;
+
+  int m_fd{-1};
+  std::string m_path;
+  std::string m_what;
+};
+
+#endif // TABLE_BUFFER_H_
@@ -0,0 +1,97 @@
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Fork-join pool for splitting loops over threads.
+ *
+ * `parallel_for` deals the index range out evenly to the pool's threads and
+ * the calling one. Each takes chunks from the front of its own share, and once
+ * it runs out, steals the back half of another's, so uneven chunks balance
+ * out. The pool runs one loop at a time: a loop started while it is busy,
+ * including one nested in a loop body, runs on the calling thread.
+ *
+ * Starting a loop does not allocate.
+ */
+class ThreadPool {
+public:
+  /**
+   * Pool running loops on `num_threads` threads, the caller's included.
+   */
+  explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency());
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  size_t num_threads() const { return m_threads.size() + 1; }
+
+  /**
+   * Call f(begin, end) on chunks of at most `grain` indices covering [0, n),
+   * and return once all are done. An exception thrown by f is rethrown here,
+   * after the other chunks have run.
+   */
+  template <typename F>
+  void parallel_for(size_t n, size_t grain, F&& f) {
+    using Function = std::remove_reference_t<F>;
+    auto invoke = [](const void* context, size_t begin, size_t end) {
+      (*static_cast<Function*>(const_cast<void*>(context)))(begin, end);
+    };
+    run(n, grain == 0 ? 1 : grain, invoke, static_cast<const void*>(std::addressof(f)));
+  }
+
+private:
+  using Invoke = void (*)(const void*, size_t, size_t);
+
+  // Share of the current loop's range held by one thread
+  struct alignas(64) Slot {
+    std::mutex mutex;
+    size_t begin{0};
+    size_t end{0};
+  };
+
+  void run(size_t n, size_t grain, Invoke invoke, const void* context);
+  void work(size_t slot);
+  void participate(size_t slot);
+  bool take(size_t slot, size_t& begin, size_t& end);
+  bool steal(size_t slot, size_t& begin, size_t& end);
+
+  std::unique_ptr<Slot[]> m_slots;
+
+  // Held while a loop runs, by the thread that started it
+  std::mutex m_loop_mutex;
+  std::atomic<std::thread::id> m_loop_owner{};
+
+  // Current loop
+  Invoke m_invoke{nullptr};
+  const void* m_context{nullptr};
+  size_t m_grain{1};
+  std::atomic<size_t> m_remaining{0};
+  std::mutex m_error_mutex;
+  std::exception_ptr m_error;
+
+  // Workers wait for a new loop on m_wake; the caller waits for the loop to
+  // complete and the workers to leave it on m_idle
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_idle;
+  uint64_t m_generation{0};
+  bool m_active{false};
+  bool m_stop{false};
+  size_t m_inside{0};
+
+  // Started last, once the state above is constructed
+  std::vector<std::thread> m_threads;
+};
+
+#endif // THREAD_POOL_H_
@@ -1,6 +1,9 @@
 #ifndef TYPES_H_
 #define TYPES_H_
 
+#include "static_vector.h"
+
+#include <cstddef>
 #include <cstdint>
 
 enum Suit {
@@ -12,9 +15,52 @@ enum Suit {
 
 constexpr uint32_t MAX_HASH_KEY = 115856201;
 
+// Most players that can be dealt in with a full board: (52 - 5) / 2
+constexpr size_t MAX_PLAYERS = 23;
+
 struct EvalResult {
   float win_prob;
   float tie_prob;
 };
 
+/**
+ * Strength and potential of a hand against a range, from the flop on.
+ *
+ * Hand strength is the share of the range the hand beats, ties counting
+ * half. EHS and EHS^2 are the mean of the final hand strength over the
+ * runouts of the board, and of its square. PPot is the chance that a hand
+ * behind now ends up ahead, NPot that a hand ahead now ends up behind, with
+ * ties counting half both ways (Billings et al.).
+ */
+struct HandPotential {
+  float hand_strength{0};
+  float ehs{0};
+  float ehs2{0};
+  float ppot{0};
+  float npot{0};
+};
+
+/**
+ * Leaders after one unseen card is dealt to the board.
+ *
+ * `leaders` has bit i set when player i holds (a share of) the best hand.
+ */
+struct CardOutcome {
+  uint32_t card;
+  uint32_t leaders;
+};
+
+struct PlayerOuts {
+  int outs{0};               // next cards making the player the sole leader when they are not
+  int tie_outs{0};           // next cards after which the player shares the lead
+  int redraws{0};            // next cards costing the player the lead that they can still win back on the river
+  bool drawing_dead{false};  // no runout lets the player win or tie
+};
+
+struct OutsResult {
+  uint32_t leaders{0};                           // players holding the best hand with the current board
+  StaticVector<PlayerOuts, MAX_PLAYERS> players; // one entry per hand, in the order given to `set_hands`
+  StaticVector<CardOutcome, 52> cards;           // one entry per unseen card
+};
+
 #endif // TYPES_H_
@@ -3,6 +3,7 @@
 
 #include "types.h"
 
+#include <algorithm>
 #include <array>
 #include <string>
 #include <vector>
@@ -0,0 +1,92 @@
+#include "app/async_evaluator.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+AsyncEvaluator::AsyncEvaluator(size_t numSimulations)
+  : numSimulations_(numSimulations), worker_([this] { run(); }) {}
+
+AsyncEvaluator::~AsyncEvaluator() {
+  {
+    std::lock_guard lock(mutex_);
+    stop_ = true;
+    ++generation_;
+  }
+  wakeUp_.notify_one();
+  worker_.join();
+}
+
+void AsyncEvaluator::start(const Situation& situation) {
+  {
+    std::lock_guard lock(mutex_);
+    ++generation_;
+    pending_ = situation;
+    progress_.reset();
+  }
+  wakeUp_.notify_one();
+}
+
+void AsyncEvaluator::cancel() {
+  std::lock_guard lock(mutex_);
+  ++generation_;
+  pending_.reset();
+  progress_.reset();
+}
+
+std::optional<AsyncEvaluator::Progress> AsyncEvaluator::poll() {
+  std::lock_guard lock(mutex_);
+  return std::exchange(progress_, std::nullopt);
+}
+
+void AsyncEvaluator::run() {
+  EvalScratch scratch;
+  std::vector<uint16_t> results;
+
+  while (true) {
+    Situation situation;
+    uint64_t generation;
+    {
+      std::unique_lock lock(mutex_);
+      wakeUp_.wait(lock, [this] { return stop_ || pending_.has_value(); });
+      if (stop_) return;
+      situation = *pending_;
+      pending_.reset();
+      generation = generation_;
+    }
+
+    // Flops, turns and rivers are enumerated in a single call (at most 990
+    // runouts); preflop hands are simulated one batch at a time
+    const size_t numHands = situation.hands.size();
+    const bool enumerated = situation.board.size() >= 3;
+    results.resize(std::max<size_t>(BATCH_SIZE, 990) * numHands);
+
+    size_t wins = 0, ties = 0, done = 0;
+    bool finished = false;
+
+    while (!finished && generation_ == generation) {
+      size_t batch = std::min(BATCH_SIZE, numSimulations_ - done);
+      size_t simulated = evaluator_.simulate(situation, scratch, results.data(), batch, done);
+
+      for (size_t i = 0; i < simulated; ++i) {
+        const uint16_t* ranks = results.data() + i * numHands;
+        uint16_t bestOther = *std::min_element(ranks + 1, ranks + numHands);
+        if (ranks[0] < bestOther) {
+          ++wins;
+        } else if (ranks[0] == bestOther) {
+          ++ties;
+        }
+      }
+      done += simulated;
+      finished = enumerated || simulated == 0 || done >= numSimulations_;
+
+      std::lock_guard lock(mutex_);
+      if (generation_ != generation || done == 0) break;
+      progress_ = Progress{
+        {static_cast<float>(wins) / static_cast<float>(done), static_cast<float>(ties) / static_cast<float>(done)},
+        done,
+        finished
+      };
+    }
+  }
+}
@@ -0,0 +1,110 @@
+#include "board_classes.hpp"
+#include "combinations.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+namespace {
+  constexpr std::array<BoardClasses::SuitPermutation, 24> PERMUTATIONS = [] {
+    std::array<BoardClasses::SuitPermutation, 24> permutations{};
+    BoardClasses::SuitPermutation suits = {0, 1, 2, 3};
+    for (auto& permutation : permutations) {
+      permutation = suits;
+      std::next_permutation(suits.begin(), suits.end());
+    }
+    return permutations;
+  }();
+
+  // Colex position of the image of a board by a suit permutation
+  template <size_t K>
+  uint32_t permuted_key(const std::array<CardIndex, K>& cards, const BoardClasses::SuitPermutation& suits) {
+    typename Combinations<K>::Combination image{};
+    for (size_t i = 0; i < K; ++i) {
+      image[i] = static_cast<CardIndex>(suits[cards[i] / 13] * 13 + cards[i] % 13);
+    }
+    std::sort(image.begin(), image.end());
+    return static_cast<uint32_t>(Combinations<K>::rank(image));
+  }
+
+  // Walk the boards in colex order, keeping those no permutation makes smaller
+  template <size_t K>
+  void find_classes(std::vector<uint32_t>& keys, std::vector<std::array<CardIndex, 5>>& boards) {
+    auto cards = Combinations<K>::first();
+    for (uint32_t key = 0; key < BINOMIALS[52][K]; ++key, Combinations<K>::next(cards)) {
+      bool canonical = true;
+      for (size_t p = 1; p < PERMUTATIONS.size() && canonical; ++p) {
+        canonical = permuted_key<K>(cards, PERMUTATIONS[p]) >= key;
+      }
+      if (canonical) {
+        keys.push_back(key);
+        boards.emplace_back();
+        std::copy(cards.begin(), cards.end(), boards.back().begin());
+      }
+    }
+  }
+
+  // Smallest key of the images of a board, and the permutation giving it
+  template <size_t K>
+  std::pair<uint32_t, size_t> smallest_key(const std::array<uint32_t, 5>& board) {
+    std::array<CardIndex, K> cards{};
+    for (size_t i = 0; i < K; ++i) {
+      cards[i] = card_index(board[i]);
+    }
+
+    std::pair<uint32_t, size_t> smallest{UINT32_MAX, 0};
+    for (size_t p = 0; p < PERMUTATIONS.size(); ++p) {
+      smallest = std::min(smallest, {permuted_key<K>(cards, PERMUTATIONS[p]), p});
+    }
+    return smallest;
+  }
+}
+
+const BoardClasses& BoardClasses::of(size_t board_size) {
+  assert(board_size >= 3 && board_size <= 5);
+  if (board_size == 3) {
+    static const BoardClasses flops(3);
+    return flops;
+  }
+  if (board_size == 4) {
+    static const BoardClasses turns(4);
+    return turns;
+  }
+  static const BoardClasses rivers(5);
+  return rivers;
+}
+
+BoardClasses::BoardClasses(size_t board_size)
+  : m_board_size{board_size} {
+  switch (board_size) {
+    case 3: find_classes<3>(m_keys, m_boards); break;
+    case 4: find_classes<4>(m_keys, m_boards); break;
+    default: find_classes<5>(m_keys, m_boards); break;
+  }
+}
+
+BoardClasses::Board BoardClasses::board(size_t index) const {
+  Board result;
+  for (size_t i = 0; i < m_board_size; ++i) {
+    result.push_back(card_at(m_boards[index][i]));
+  }
+  return result;
+}
+
+BoardClasses::Canonical BoardClasses::classify(const Board& board) const {
+  assert(board.size() == m_board_size);
+
+  std::array<uint32_t, 5> cards{};
+  std::copy(board.begin(), board.end(), cards.begin());
+  std::pair<uint32_t, size_t> smallest;
+  switch (m_board_size) {
+    case 3: smallest = smallest_key<3>(cards); break;
+    case 4: smallest = smallest_key<4>(cards); break;
+    default: smallest = smallest_key<5>(cards); break;
+  }
+
+  auto it = std::lower_bound(m_keys.begin(), m_keys.end(), smallest.first);
+  assert(it != m_keys.end() && *it == smallest.first);
+  return {static_cast<size_t>(it - m_keys.begin()), PERMUTATIONS[smallest.second]};
+}
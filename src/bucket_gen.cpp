@@ -0,0 +1,87 @@
+// Generates the card abstraction read by `BucketTable`.
+//
+//   bucket_gen FILE [--buckets N] [--bins N] [--samples N] [--boards N] [--threads N]
+//
+// Combos are bucketed by their equity against a random hand. The clusters
+// of each street are fitted on the boards of a random sample, then every
+// board class is bucketed and written out in order.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "bucket_table.hpp"
+
+namespace {
+  void print_usage(const char* program_name) {
+    BucketTable::GenerateOptions defaults;
+    std::cout << "Usage: " << program_name << " FILE [options]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --buckets N           Buckets per street, at most 254 (default: " << defaults.num_buckets << ")\n";
+    std::cout << "  --bins N              Equity histogram bins on the flop and the turn (default: "
+              << defaults.num_bins << ")\n";
+    std::cout << "  --samples N           Boards per street sampled to fit the buckets (default: "
+              << defaults.sample_boards << ")\n";
+    std::cout << "  --boards N            Only write the first N boards of each street\n";
+    std::cout << "  --threads N           Worker threads (default: one per core)\n";
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::string path;
+  BucketTable::GenerateOptions options;
+  options.num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg == "--buckets" && i + 1 < argc) {
+        options.num_buckets = std::stoul(argv[++i]);
+      } else if (arg == "--bins" && i + 1 < argc) {
+        options.num_bins = std::stoul(argv[++i]);
+      } else if (arg == "--samples" && i + 1 < argc) {
+        options.sample_boards = std::stoul(argv[++i]);
+      } else if (arg == "--boards" && i + 1 < argc) {
+        options.max_boards = std::stoul(argv[++i]);
+      } else if (arg == "--threads" && i + 1 < argc) {
+        options.num_threads = std::stoul(argv[++i]);
+      } else if (path.empty() && arg[0] != '-') {
+        path = arg;
+      } else {
+        path.clear();
+        break;
+      }
+    }
+  } catch (const std::exception&) {
+    path.clear();
+  }
+
+  if (path.empty()) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  const char* streets[] = {"flops", "turns", "rivers"};
+  auto start = std::chrono::steady_clock::now();
+  options.progress = [&](size_t board_size, size_t done, size_t total) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "\r" << done << "/" << total << " " << streets[board_size - 3] << ", "
+              << static_cast<int>(seconds) << "s elapsed   " << std::flush;
+    if (done == total) {
+      std::cerr << std::endl;
+    }
+  };
+
+  try {
+    BucketTable::generate(path, options);
+    auto table = BucketTable::load(path);
+    std::cerr << "Wrote " << table.num_boards(3) << " flops, " << table.num_boards(4) << " turns and "
+              << table.num_boards(5) << " rivers in " << table.num_buckets() << " buckets" << std::endl;
+  } catch (const std::exception& e) {
+    std::cerr << "\nError: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,413 @@
+#include "bucket_table.hpp"
+#include "card_set.h"
+#include "range_evaluation.hpp"
+#include "rng.h"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+  constexpr char MAGIC[8] = {'P', 'E', 'B', 'U', 'C', 'K', 'T', '1'};
+  constexpr size_t NUM_COMBOS = BucketTable::NUM_COMBOS;
+  constexpr size_t HEADER_BYTES = 4096;
+
+  // Boards bucketed between two writes
+  constexpr size_t CHUNK_BOARDS = 64;
+
+  struct FileHeader {
+    char magic[8];
+    uint32_t num_buckets;
+    uint32_t num_bins;
+    uint32_t num_boards[3];
+  };
+  static_assert(sizeof(FileHeader) <= HEADER_BYTES);
+
+  size_t file_bytes(const FileHeader& header) {
+    return HEADER_BYTES + (size_t(header.num_boards[0]) + header.num_boards[1] + header.num_boards[2]) * NUM_COMBOS;
+  }
+
+  // Every combo with weight 1, in combo index order
+  const HandRange& all_combos() {
+    static const HandRange range = [] {
+      HandRange combos;
+      for (int second = 1; second < 52; ++second) {
+        for (int first = 0; first < second; ++first) {
+          combos.addHand(card_at(first), card_at(second));
+        }
+      }
+      return combos;
+    }();
+    return range;
+  }
+
+  // Whether permuting the suits leaves the weight of every combo of the range
+  // unchanged. A transposition and a 4-cycle generate all the permutations
+  bool suit_symmetric(const HandRange& range) {
+    auto weights = [&](const BoardClasses::SuitPermutation& suits) {
+      std::vector<double> combos(NUM_COMBOS, 0.0);
+      for (const auto& [hand, weight] : range.hands()) {
+        combos[BucketTable::combo_index(card_index(BoardClasses::permute(hand.first, suits)),
+                                        card_index(BoardClasses::permute(hand.second, suits)))] += weight;
+      }
+      return combos;
+    };
+    auto identity = weights({0, 1, 2, 3});
+    return weights({1, 0, 2, 3}) == identity && weights({1, 2, 3, 0}) == identity;
+  }
+
+  size_t dimensions(size_t board_size, size_t num_bins) {
+    return board_size == 5 ? 1 : num_bins;
+  }
+
+  float distance(const float* a, const float* b, size_t dims) {
+    float d = 0;
+    for (size_t i = 0; i < dims; ++i) {
+      d += (a[i] - b[i]) * (a[i] - b[i]);
+    }
+    return d;
+  }
+
+  size_t nearest(const float* point, const std::vector<float>& centroids, size_t dims) {
+    size_t best = 0;
+    float best_distance = std::numeric_limits<float>::max();
+    for (size_t k = 0; k * dims < centroids.size(); ++k) {
+      float d = distance(point, centroids.data() + k * dims, dims);
+      if (d < best_distance) {
+        best_distance = d;
+        best = k;
+      }
+    }
+    return best;
+  }
+
+  // Mean equity behind a feature vector: the equity itself, or the area
+  // above a cumulative histogram
+  float strength(const float* feature, size_t dims) {
+    if (dims == 1) {
+      return feature[0];
+    }
+    float area = 0;
+    for (size_t i = 0; i < dims; ++i) {
+      area += 1.f - feature[i];
+    }
+    return area / static_cast<float>(dims);
+  }
+
+  /**
+   * k-means++ seeding followed by Lloyd iterations over `points` of `dims`
+   * values each. Returns the centroids, weakest first. The assignment steps
+   * run on the pool; the result does not depend on its size.
+   */
+  std::vector<float> cluster(const std::vector<float>& points, size_t dims, size_t k, size_t iterations,
+                             uint64_t seed, ThreadPool& pool) {
+    const size_t n = points.size() / dims;
+    assert(n > 0);
+    Philox4x32 rng(seed);
+    auto uniform = [&] { return (rng() >> 8) * (1.0 / (1u << 24)); };
+
+    // Seeding: each centroid is a point drawn with probability proportional
+    // to its squared distance to the nearest centroid so far
+    std::vector<float> centroids(points.begin(), points.begin() + dims);
+    std::vector<float> closest(n, std::numeric_limits<float>::max());
+    for (size_t c = 1; c < k; ++c) {
+      const float* last = centroids.data() + (c - 1) * dims;
+      double total = 0;
+      for (size_t i = 0; i < n; ++i) {
+        closest[i] = std::min(closest[i], distance(points.data() + i * dims, last, dims));
+        total += closest[i];
+      }
+
+      size_t chosen = rng.bounded(static_cast<uint32_t>(n));
+      if (total > 0) {
+        double target = uniform() * total;
+        for (chosen = 0; chosen + 1 < n && (target -= closest[chosen]) > 0; ++chosen) {}
+      }
+      centroids.insert(centroids.end(), points.begin() + chosen * dims, points.begin() + (chosen + 1) * dims);
+    }
+
+    std::vector<uint32_t> labels(n, UINT32_MAX);
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+      std::atomic<size_t> changed{0};
+      pool.parallel_for(n, 4096, [&](size_t begin, size_t end) {
+        size_t moved = 0;
+        for (size_t i = begin; i < end; ++i) {
+          uint32_t label = static_cast<uint32_t>(nearest(points.data() + i * dims, centroids, dims));
+          moved += label != labels[i];
+          labels[i] = label;
+        }
+        changed += moved;
+      });
+      if (changed == 0) {
+        break;
+      }
+
+      std::vector<double> sums(k * dims, 0.0);
+      std::vector<size_t> counts(k, 0);
+      for (size_t i = 0; i < n; ++i) {
+        ++counts[labels[i]];
+        for (size_t d = 0; d < dims; ++d) {
+          sums[labels[i] * dims + d] += points[i * dims + d];
+        }
+      }
+      for (size_t c = 0; c < k; ++c) {
+        if (counts[c] == 0) {
+          // Restart an empty cluster from the point farthest from its own
+          size_t farthest = 0;
+          float farthest_distance = -1;
+          for (size_t i = 0; i < n; ++i) {
+            float d = distance(points.data() + i * dims, centroids.data() + labels[i] * dims, dims);
+            if (d > farthest_distance) {
+              farthest_distance = d;
+              farthest = i;
+            }
+          }
+          std::copy_n(points.begin() + farthest * dims, dims, centroids.begin() + c * dims);
+          continue;
+        }
+        for (size_t d = 0; d < dims; ++d) {
+          centroids[c * dims + d] = static_cast<float>(sums[c * dims + d] / counts[c]);
+        }
+      }
+    }
+
+    // Number the buckets from the weakest
+    std::vector<size_t> order(k);
+    for (size_t c = 0; c < k; ++c) {
+      order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return strength(centroids.data() + a * dims, dims) < strength(centroids.data() + b * dims, dims);
+    });
+    std::vector<float> sorted;
+    for (size_t c : order) {
+      sorted.insert(sorted.end(), centroids.begin() + c * dims, centroids.begin() + (c + 1) * dims);
+    }
+    return sorted;
+  }
+
+  // A board of `board_size` cards dealt uniformly
+  BoardClasses::Board random_board(size_t board_size, Philox4x32& rng) {
+    std::array<int, 52> deck;
+    for (int i = 0; i < 52; ++i) {
+      deck[i] = i;
+    }
+    BoardClasses::Board board;
+    for (size_t i = 0; i < board_size; ++i) {
+      std::swap(deck[i], deck[i + rng.bounded(static_cast<uint32_t>(52 - i))]);
+      board.push_back(card_at(deck[i]));
+    }
+    return board;
+  }
+}
+
+void BucketTable::features(const BoardClasses::Board& board, const HandRange& range, size_t num_bins,
+                           std::vector<float>& features, std::vector<bool>& valid) {
+  assert(board.size() >= 3 && board.size() <= 5);
+
+  const size_t dims = dimensions(board.size(), num_bins);
+  features.assign(NUM_COMBOS * dims, 0.f);
+  valid.assign(NUM_COMBOS, false);
+
+  const HandRange& hero = all_combos();
+  const HandRange& villain = range.hands().empty() ? hero : range;
+
+  // Not shared between threads; kept to reuse its buffers
+  thread_local RangeEvaluator evaluator;
+  thread_local std::vector<uint32_t> runouts;
+  runouts.assign(NUM_COMBOS, 0);
+
+  // Equity of every combo on one complete board
+  auto add_runout = [&](const BoardClasses::Board& full) {
+    evaluator.set_board(full.begin(), full.end());
+    const auto& totals = evaluator.totals(hero, villain);
+    for (size_t c = 0; c < NUM_COMBOS; ++c) {
+      const ComboTotals& t = totals[c];
+      if (t.total <= 0) continue;
+
+      float equity = static_cast<float>((t.win + t.tie / 2) / t.total);
+      if (dims == 1) {
+        features[c] = equity;
+      } else {
+        size_t bin = std::min(static_cast<size_t>(equity * static_cast<float>(num_bins)), num_bins - 1);
+        features[c * dims + bin] += 1.f;
+      }
+      ++runouts[c];
+    }
+  };
+
+  CardSet board_cards(board.begin(), board.end());
+  StaticVector<uint32_t, 52> deck;
+  (CardSet::full() - board_cards).for_each([&](uint32_t card) { deck.push_back(card); });
+
+  if (board.size() == 3) {
+    for (size_t j = 1; j < deck.size(); ++j) {
+      for (size_t i = 0; i < j; ++i) {
+        auto full = board;
+        full.push_back(deck[i]);
+        full.push_back(deck[j]);
+        add_runout(full);
+      }
+    }
+  } else if (board.size() == 4) {
+    for (uint32_t card : deck) {
+      auto full = board;
+      full.push_back(card);
+      add_runout(full);
+    }
+  } else {
+    add_runout(board);
+  }
+
+  for (size_t c = 0; c < NUM_COMBOS; ++c) {
+    valid[c] = runouts[c] > 0;
+    if (dims == 1 || !valid[c]) continue;
+
+    // Histogram to cumulative shares
+    float cumulative = 0;
+    for (size_t bin = 0; bin < dims; ++bin) {
+      cumulative += features[c * dims + bin];
+      features[c * dims + bin] = cumulative / static_cast<float>(runouts[c]);
+    }
+  }
+}
+
+void BucketTable::generate(const std::string& path, const GenerateOptions& options) {
+  if (options.num_buckets == 0 || options.num_buckets >= BLOCKED || options.num_bins == 0 ||
+      options.sample_boards == 0 || options.num_threads == 0) {
+    throw std::invalid_argument("Invalid bucket table options");
+  }
+  // Boards and hole cards are looked up through their suit-isomorphism class
+  if (!suit_symmetric(options.range)) {
+    throw std::invalid_argument("Reference range must give the same weight to suit isomorphic combos");
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.num_buckets = static_cast<uint32_t>(options.num_buckets);
+  header.num_bins = static_cast<uint32_t>(options.num_bins);
+  for (size_t board_size = 3; board_size <= 5; ++board_size) {
+    size_t boards = std::min(options.max_boards, BoardClasses::of(board_size).size());
+    header.num_boards[board_size - 3] = static_cast<uint32_t>(boards);
+  }
+
+  FileWriter file(path, "bucket table", true);
+  ThreadPool pool(options.num_threads);
+  size_t offset = HEADER_BYTES;
+
+  for (size_t board_size = 3; board_size <= 5; ++board_size) {
+    const auto& classes = BoardClasses::of(board_size);
+    const size_t dims = dimensions(board_size, options.num_bins);
+
+    // Fit the clusters on the combos of boards dealt at random, so that
+    // each class weighs as much as the boards it stands for
+    Philox4x32 rng(options.seed, board_size);
+    std::vector<BoardClasses::Board> samples;
+    for (size_t i = 0; i < options.sample_boards; ++i) {
+      samples.push_back(random_board(board_size, rng));
+    }
+
+    std::vector<std::vector<float>> sample_points(samples.size());
+    pool.parallel_for(samples.size(), 1, [&](size_t begin, size_t end) {
+      std::vector<float> board_features;
+      std::vector<bool> valid;
+      for (size_t s = begin; s < end; ++s) {
+        features(samples[s], options.range, options.num_bins, board_features, valid);
+        for (size_t c = 0; c < NUM_COMBOS; ++c) {
+          if (valid[c]) {
+            sample_points[s].insert(sample_points[s].end(), board_features.begin() + c * dims,
+                                    board_features.begin() + (c + 1) * dims);
+          }
+        }
+      }
+    });
+
+    std::vector<float> points;
+    for (auto& board_points : sample_points) {
+      points.insert(points.end(), board_points.begin(), board_points.end());
+      std::vector<float>().swap(board_points);
+    }
+    if (points.empty()) {
+      throw std::invalid_argument("Reference range leaves no combo to bucket");
+    }
+    auto centroids = cluster(points, dims, options.num_buckets, options.iterations,
+                             options.seed + board_size, pool);
+    std::vector<float>().swap(points);
+
+    // Bucket the classes in order, one chunk of boards at a time
+    const size_t num_boards = header.num_boards[board_size - 3];
+    std::vector<uint8_t> chunk;
+    for (size_t first = 0; first < num_boards; first += CHUNK_BOARDS) {
+      const size_t count = std::min(CHUNK_BOARDS, num_boards - first);
+      chunk.assign(count * NUM_COMBOS, BLOCKED);
+
+      pool.parallel_for(count, 1, [&](size_t begin, size_t end) {
+        std::vector<float> board_features;
+        std::vector<bool> valid;
+        for (size_t b = begin; b < end; ++b) {
+          features(classes.board(first + b), options.range, options.num_bins, board_features, valid);
+          for (size_t c = 0; c < NUM_COMBOS; ++c) {
+            if (valid[c]) {
+              chunk[b * NUM_COMBOS + c] =
+                static_cast<uint8_t>(nearest(board_features.data() + c * dims, centroids, dims));
+            }
+          }
+        }
+      });
+
+      file.write_at(chunk.data(), chunk.size(), offset);
+      offset += chunk.size();
+      if (options.progress) {
+        options.progress(board_size, first + count, num_boards);
+      }
+    }
+  }
+
+  // The header goes last, so an interrupted run leaves no valid table
+  file.write_at(&header, sizeof(header), 0);
+  file.sync();
+}
+
+BucketTable BucketTable::load(const std::string& path) {
+  BucketTable table;
+  table.m_file = MappedFile(path, "bucket table");
+  const size_t size = table.m_file.size();
+  const auto* header = table.m_file.as<FileHeader>();
+  if (size < HEADER_BYTES || std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || file_bytes(*header) != size ||
+      header->num_buckets == 0 || header->num_buckets >= BLOCKED) {
+    throw std::runtime_error("Invalid bucket table: " + path);
+  }
+  // Each lookup reads one byte at a random place
+  table.m_file.advise_random();
+
+  table.m_num_buckets = header->num_buckets;
+  const uint8_t* street = table.m_file.as<uint8_t>(HEADER_BYTES);
+  for (size_t s = 0; s < 3; ++s) {
+    table.m_num_boards[s] = header->num_boards[s];
+    table.m_streets[s] = street;
+    street += table.m_num_boards[s] * NUM_COMBOS;
+  }
+  return table;
+}
+
+std::optional<uint8_t> BucketTable::bucket(const std::array<uint32_t, 2>& hole, const BoardClasses::Board& board) const {
+  assert(board.size() >= 3 && board.size() <= 5);
+
+  const auto canonical = BoardClasses::of(board.size()).classify(board);
+  if (canonical.index >= num_boards(board.size())) {
+    return std::nullopt;
+  }
+
+  size_t combo = combo_index(card_index(BoardClasses::permute(hole[0], canonical.suits)),
+                             card_index(BoardClasses::permute(hole[1], canonical.suits)));
+  uint8_t bucket = m_streets[board.size() - 3][canonical.index * NUM_COMBOS + combo];
+  if (bucket == BLOCKED) {
+    return std::nullopt;
+  }
+  return bucket;
+}
@@ -1,34 +1,34 @@
 #include "app/card_selector.hpp"
 #include "app/draw_card.hpp"
-#include <algorithm>
+
+namespace {
+  constexpr char SUITS[4] = {'h', 'd', 'c', 's'};
+}
 
 CardSelector::CardSelector(const sf::Vector2f& position, const sf::Vector2f& cardSize)
-  : position_(position), cardSize_(cardSize) {}
+  : position_(position), cardSize_(cardSize),
+    grid_(sf::PrimitiveType::Triangles), highlights_(sf::PrimitiveType::Triangles) {
+  appendRect(grid_, position_, {cardSize_.x * 13.f, cardSize_.y * 4.f}, sf::Color::Black);
 
-void CardSelector::draw(sf::RenderTarget& rt) const {
-  sf::RectangleShape selectorRect({cardSize_.x * 13.f, cardSize_.y * 4.f});
-  selectorRect.setOrigin({0.f, 0.f});
-  selectorRect.setPosition(position_);
-  selectorRect.setFillColor(sf::Color::Black);
-  rt.draw(selectorRect);
-
-  for (auto suit : {'h', 'd', 'c', 's'}) {
-    for (int rank = 2; rank <= 14; ++rank) {
-      const sf::Vector2f cardPosition = {
-        position_.x + (rank - 2) * cardSize_.x,
-        position_.y + (suit == 'h' ? 0.f : suit == 'd' ? cardSize_.y : suit == 'c' ? 2 * cardSize_.y : 3 * cardSize_.y)
-      };
-      drawCard({rank, suit}, rt, cardPosition, cardSize_ - sf::Vector2f{1.f, 1.f});
-      if (std::find(selectedCards_.begin(), selectedCards_.end(), (rank - 2) + (suit == 'h' ? 0 : suit == 'd' ? 13 : suit == 'c' ? 26 : 39)) != selectedCards_.end()) {
-        sf::RectangleShape highlight(cardSize_);
-        highlight.setPosition(cardPosition);
-        highlight.setFillColor(sf::Color(0, 40, 0, 200)); // Semi-transparent green
-        rt.draw(highlight);
-      }
+  for (int index = 0; index < 52; ++index) {
+    const Card card{index % 13 + 2, SUITS[index / 13]};
+    const sf::Vector2f faceSize = cardSize_ - sf::Vector2f{1.f, 1.f};
+
+    appendRect(grid_, cardPosition(index), faceSize, sf::Color::White);
+    for (auto& label : cardLabels(card, cardPosition(index), faceSize)) {
+      labels_.push_back(std::move(label));
     }
   }
 }
 
+void CardSelector::draw(sf::RenderTarget& rt) const {
+  rt.draw(grid_);
+  for (const auto& label : labels_) {
+    rt.draw(label);
+  }
+  rt.draw(highlights_);
+}
+
 std::optional<Card> CardSelector::getClickedCard(const sf::Vector2i& mousePos) const {
   sf::Vector2f relativePos = static_cast<sf::Vector2f>(mousePos) - position_;
 
@@ -43,28 +43,36 @@ std::optional<Card> CardSelector::getClickedCard(const sf::Vector2i& mousePos) c
     return std::nullopt;
   }
 
-  int rank = col + 2;
-  char suit;
-  switch (row) {
-  case 0: suit = 'h'; break;
-  case 1: suit = 'd'; break;
-  case 2: suit = 'c'; break;
-  case 3: suit = 's'; break;
-  default: return std::nullopt;
-  }
-
-  if (std::find(selectedCards_.begin(), selectedCards_.end(), (rank - 2) + (suit == 'h' ? 0 : suit == 'd' ? 13 : suit == 'c' ? 26 : 39)) != selectedCards_.end()) {
+  if (selectedCards_.test(row * 13 + col)) {
     return std::nullopt; // Card already selected
   }
 
-  return Card{rank, suit};
+  return Card{col + 2, SUITS[row]};
 }
 
 void CardSelector::selectCard(const Card& card) {
-  int index = (card.rank - 2) + (card.suit == 'h' ? 0 : card.suit == 'd' ? 13 : card.suit == 'c' ? 26 : 39);
-  selectedCards_.push_back(index);
+  selectedCards_.set(gridIndex(card));
+  updateHighlights();
 }
 
 void CardSelector::reset() {
-  selectedCards_.clear();
+  selectedCards_.reset();
+  updateHighlights();
+}
+
+int CardSelector::gridIndex(const Card& card) {
+  return (card.rank - 2) + (card.suit == 'h' ? 0 : card.suit == 'd' ? 13 : card.suit == 'c' ? 26 : 39);
+}
+
+sf::Vector2f CardSelector::cardPosition(int index) const {
+  return {position_.x + (index % 13) * cardSize_.x, position_.y + (index / 13) * cardSize_.y};
+}
+
+void CardSelector::updateHighlights() {
+  highlights_.clear();
+  for (int index = 0; index < 52; ++index) {
+    if (selectedCards_.test(index)) {
+      appendRect(highlights_, cardPosition(index), cardSize_, sf::Color(0, 40, 0, 200)); // Semi-transparent green
+    }
+  }
 }
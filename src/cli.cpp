@@ -1,5 +1,7 @@
 #include <array>
+#include <filesystem>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -7,18 +9,35 @@
 
 #include "types.h"
 #include "utils.h"
+#include "card_set.h"
 #include "evaluation.hpp"
+#include "flop_database.hpp"
+#include "split_eval.h"
+#include "state_table.hpp"
+#include "stats.h"
 
 void print_usage(const char* program_name) {
-    std::cout << "Usage: " << program_name << " <hand1> <hand2> [board]\n\n";
+    std::cout << "Usage: " << program_name << " [options] <hand1> <hand2> [board]\n";
+    std::cout << "       " << program_name << " [options] --vs-random N <hand1> [board]\n\n";
     std::cout << "Arguments:\n";
     std::cout << "  hand1   First player's 2 cards (e.g., \"As Kh\")\n";
     std::cout << "  hand2   Second player's 2 cards (e.g., \"Qd Jc\")\n";
     std::cout << "  board   Optional board cards (e.g., \"Ts 9h 8d\")\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --vs-random N         Play hand1 against N opponents holding random hands\n";
+    std::cout << "  --dead CARDS          Cards out of play (e.g., \"2c 7d\"), never dealt\n";
+    std::cout << "  --seed N              Seed for preflop Monte Carlo sampling (default: fixed seed)\n";
+    std::cout << "  --state-table FILE    Rank hands with the state table mapped from FILE,\n";
+    std::cout << "                        building and saving it there first if needed\n";
+    std::cout << "  --flop-db FILE        Look heads-up flops up in the database FILE written\n";
+    std::cout << "                        by flop_db_gen\n";
+    std::cout << "  --stats               Print evaluation counters and timings (needs a build\n";
+    std::cout << "                        with -DENABLE_STATS=ON)\n\n";
     std::cout << "Card format: [2-9TJQKA][shdc] (rank + suit)\n";
     std::cout << "Examples:\n";
     std::cout << "  " << program_name << " \"As Ah\" \"Kd Kc\"\n";
     std::cout << "  " << program_name << " \"As Kh\" \"Qd Jc\" \"Ts 9h 8d\"\n";
+    std::cout << "  " << program_name << " --vs-random 3 \"As Kh\"\n";
 }
 
 std::vector<uint32_t> parse_cards(const std::string& cards_str) {
@@ -44,55 +63,96 @@ std::vector<uint32_t> parse_cards(const std::string& cards_str) {
 }
 
 int main(int argc, char* argv[]) {
-    if (argc < 3 || argc > 4) {
+    std::vector<std::string> args;
+    uint64_t seed = Evaluator::DEFAULT_SEED;
+    std::string state_table_path;
+    std::string flop_db_path;
+    std::string dead_str;
+    size_t vs_random = 0;
+    bool print_stats = false;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--seed" && i + 1 < argc) {
+                seed = std::stoull(argv[++i]);
+            } else if (arg == "--state-table" && i + 1 < argc) {
+                state_table_path = argv[++i];
+            } else if (arg == "--vs-random" && i + 1 < argc) {
+                vs_random = std::stoul(argv[++i]);
+            } else if (arg == "--dead" && i + 1 < argc) {
+                dead_str = argv[++i];
+            } else if (arg == "--flop-db" && i + 1 < argc) {
+                flop_db_path = argv[++i];
+            } else if (arg == "--stats") {
+                print_stats = true;
+            } else {
+                args.push_back(arg);
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Error: Invalid number\n";
+        return 1;
+    }
+
+    // Hands given on the command line, before the board
+    const size_t num_hands = vs_random > 0 ? 1 : 2;
+    if (args.size() < num_hands || args.size() > num_hands + 1) {
         print_usage(argv[0]);
         return 1;
     }
 
     try {
         // Parse hands
-        std::vector<uint32_t> hand1_cards = parse_cards(argv[1]);
-        std::vector<uint32_t> hand2_cards = parse_cards(argv[2]);
-
-        if (hand1_cards.size() != 2) {
-            std::cerr << "Error: Hand 1 must contain exactly 2 cards\n";
-            return 1;
+        // Combine hands into single vector for Evaluator
+        std::vector<uint32_t> hands;
+        for (size_t i = 0; i < num_hands; ++i) {
+            std::vector<uint32_t> hand_cards = parse_cards(args[i]);
+            if (hand_cards.size() != 2) {
+                std::cerr << "Error: Hand " << i + 1 << " must contain exactly 2 cards\n";
+                return 1;
+            }
+            hands.insert(hands.end(), hand_cards.begin(), hand_cards.end());
         }
-        if (hand2_cards.size() != 2) {
-            std::cerr << "Error: Hand 2 must contain exactly 2 cards\n";
+
+        if (vs_random > 0 && 1 + vs_random > MAX_PLAYERS) {
+            std::cerr << "Error: At most " << MAX_PLAYERS - 1 << " random opponents\n";
             return 1;
         }
 
-        // Combine hands into single vector for Evaluator
-        std::vector<uint32_t> hands;
-        hands.insert(hands.end(), hand1_cards.begin(), hand1_cards.end());
-        hands.insert(hands.end(), hand2_cards.begin(), hand2_cards.end());
-
         // Parse board if provided
         std::vector<uint32_t> board_cards;
-        if (argc == 4) {
-            board_cards = parse_cards(argv[3]);
+        if (args.size() == num_hands + 1) {
+            board_cards = parse_cards(args[num_hands]);
             if (board_cards.size() > 5) {
                 std::cerr << "Error: Board cannot contain more than 5 cards\n";
                 return 1;
             }
         }
 
+        std::vector<uint32_t> dead_cards = parse_cards(dead_str);
+
         // Check for duplicate cards
-        std::vector<uint32_t> all_cards = hands;
-        all_cards.insert(all_cards.end(), board_cards.begin(), board_cards.end());
-        std::sort(all_cards.begin(), all_cards.end());
-        if (std::adjacent_find(all_cards.begin(), all_cards.end()) != all_cards.end()) {
-            std::cerr << "Error: Duplicate cards detected\n";
-            return 1;
+        CardSet seen;
+        for (const auto& cards : {hands, board_cards, dead_cards}) {
+            for (uint32_t card : cards) {
+                if (seen.contains(card)) {
+                    std::cerr << "Error: Duplicate cards detected\n";
+                    return 1;
+                }
+                seen.insert(card);
+            }
         }
 
         // Display input
         std::array<uint32_t, 2> hand1_array = {hands[0], hands[1]};
-        std::array<uint32_t, 2> hand2_array = {hands[2], hands[3]};
-
         std::cout << "Player 1: " << to_string(hand1_array) << std::endl;
-        std::cout << "Player 2: " << to_string(hand2_array) << std::endl;
+        if (vs_random > 0) {
+            std::cout << "Opponents: " << vs_random << " random " << (vs_random == 1 ? "hand" : "hands") << std::endl;
+        } else {
+            std::array<uint32_t, 2> hand2_array = {hands[2], hands[3]};
+            std::cout << "Player 2: " << to_string(hand2_array) << std::endl;
+        }
 
         if (!board_cards.empty()) {
             std::string board_str;
@@ -102,17 +162,43 @@ int main(int argc, char* argv[]) {
             }
             std::cout << "Board: " << board_str << std::endl;
         }
+        if (!dead_cards.empty()) {
+            std::string dead_cards_str;
+            for (size_t i = 0; i < dead_cards.size(); ++i) {
+                if (i > 0) dead_cards_str += " ";
+                dead_cards_str += to_string(dead_cards[i]);
+            }
+            std::cout << "Dead: " << dead_cards_str << std::endl;
+        }
         std::cout << std::endl;
 
         // Evaluate
-        auto evaluator = Evaluator();
+        auto evaluator = Evaluator(seed);
+
+        if (!state_table_path.empty()) {
+            if (!std::filesystem::exists(state_table_path)) {
+                std::cerr << "Building state table " << state_table_path << "...\n";
+                StateTable::build().save(state_table_path);
+            }
+            evaluator.set_state_table(std::make_shared<const StateTable>(StateTable::load(state_table_path)));
+        }
+        if (!flop_db_path.empty()) {
+            evaluator.set_flop_database(std::make_shared<const FlopDatabase>(FlopDatabase::load(flop_db_path)));
+        }
         evaluator.set_hands(hands.begin(), hands.end());
 
         if (!board_cards.empty()) {
             evaluator.set_board(board_cards.begin(), board_cards.end());
         }
+        evaluator.set_dead_cards(dead_cards.begin(), dead_cards.end());
+
+        if (print_stats) {
+            // Leave the construction of the lookup tables out of the timings
+            split_evaluator();
+            reset_eval_stats();
+        }
 
-        auto result = evaluator.evaluate();
+        auto result = vs_random > 0 ? evaluator.evaluate_vs_random(vs_random) : evaluator.evaluate();
         float prob1 = result.win_prob;
         float prob_tie = result.tie_prob;
         float prob2 = 1.0f - prob1 - prob_tie;
@@ -120,9 +206,29 @@ int main(int argc, char* argv[]) {
         // Display results
         std::cout << std::fixed << std::setprecision(2);
         std::cout << "Player 1 win: " << std::setw(5) << prob1 * 100.0f << "%" << std::endl;
-        std::cout << "Player 2 win: " << std::setw(5) << prob2 * 100.0f << "%" << std::endl;
+        std::cout << (vs_random > 0 ? "Others win:   " : "Player 2 win: ") << std::setw(5) << prob2 * 100.0f << "%" << std::endl;
         std::cout << "Ties:         " << std::setw(5) << prob_tie * 100.0f << "%" << std::endl;
 
+        if (print_stats) {
+            std::cout << std::endl;
+            if (!eval_stats_enabled) {
+                std::cout << "Statistics are not available: rebuild with -DENABLE_STATS=ON" << std::endl;
+            } else {
+                EvalStats stats = eval_stats();
+                std::cout << "eval5 calls:    " << stats.eval5_calls << std::endl;
+                std::cout << "  flush:        " << stats.flush_hits << std::endl;
+                std::cout << "  unique5:      " << stats.unique5_hits << std::endl;
+                std::cout << "  hash:         " << stats.hash_hits << std::endl;
+                std::cout << "eval7 calls:    " << stats.eval7_calls << std::endl;
+                std::cout << "Simulations:    " << stats.simulations << std::endl;
+                std::cout << "Deck rebuilds:  " << stats.deck_rebuilds << std::endl;
+                std::cout << std::setprecision(3);
+                std::cout << "Setup:          " << stats.setup_seconds * 1e3 << " ms" << std::endl;
+                std::cout << "Simulate:       " << stats.simulate_seconds * 1e3 << " ms" << std::endl;
+                std::cout << "Reduce:         " << stats.reduce_seconds * 1e3 << " ms" << std::endl;
+            }
+        }
+
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
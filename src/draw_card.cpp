@@ -2,15 +2,13 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 
-void drawCard(const Card& card, sf::RenderTarget& rt, const sf::Vector2f& position, const sf::Vector2f& size) {
-  sf::RectangleShape cardRect(size);
-  cardRect.setPosition(position);
-  cardRect.setFillColor(sf::Color::White);
-  rt.draw(cardRect);
-
-  sf::Font font("resources/DejaVuSans.ttf");
+const sf::Font& appFont() {
+  static const sf::Font font("resources/DejaVuSans.ttf");
+  return font;
+}
 
-  sf::Text rankText(font);
+std::array<sf::Text, 2> cardLabels(const Card& card, const sf::Vector2f& position, const sf::Vector2f& size) {
+  sf::Text rankText(appFont());
 
   switch (card.rank) {
     case 14:
@@ -33,13 +31,12 @@ void drawCard(const Card& card, sf::RenderTarget& rt, const sf::Vector2f& positi
   const float characterSize = size.y / 3.f;
 
   rankText.setCharacterSize(characterSize);
-  // rankText.setPosition({position.x + (rank == 11 ? 24.f : 12.f), position.y + 4.f});
 
   const float rankTextWidth = rankText.getLocalBounds().size.x;
   const float rankCenterX = position.x + (size.x / 2.f) - (rankTextWidth / 2.f);
   rankText.setPosition({rankCenterX, position.y + 4.f});
 
-  sf::Text suitText(font);
+  sf::Text suitText(appFont());
   switch (card.suit) {
     case 'h':
       suitText.setString(L"♥");
@@ -66,10 +63,29 @@ void drawCard(const Card& card, sf::RenderTarget& rt, const sf::Vector2f& positi
 
   const float suitTextWidth = suitText.getLocalBounds().size.x;
   const float suitCenterX = position.x + (size.x / 2.f) - (suitTextWidth / 2.f);
-  const float suitTextHeight = suitText.getLocalBounds().size.y;
 
   suitText.setPosition({suitCenterX, position.y + size.y / 2.f});
 
-  rt.draw(rankText);
-  rt.draw(suitText);
+  return {rankText, suitText};
+}
+
+void appendRect(sf::VertexArray& vertices, const sf::Vector2f& position, const sf::Vector2f& size, sf::Color color) {
+  const sf::Vector2f topRight = position + sf::Vector2f{size.x, 0.f};
+  const sf::Vector2f bottomLeft = position + sf::Vector2f{0.f, size.y};
+  const sf::Vector2f bottomRight = position + size;
+
+  for (const auto& corner : {position, topRight, bottomLeft, topRight, bottomRight, bottomLeft}) {
+    vertices.append({corner, color});
+  }
+}
+
+void drawCard(const Card& card, sf::RenderTarget& rt, const sf::Vector2f& position, const sf::Vector2f& size) {
+  sf::RectangleShape cardRect(size);
+  cardRect.setPosition(position);
+  cardRect.setFillColor(sf::Color::White);
+  rt.draw(cardRect);
+
+  for (const auto& label : cardLabels(card, position, size)) {
+    rt.draw(label);
+  }
 }
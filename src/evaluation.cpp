@@ -2,141 +2,779 @@
 #include "types.h"
 #include "utils.h"
 #include "bitset_rankindex.h"
+#include "card_set.h"
+#include "combinations.h"
 #include "eval.h"
+#include "flop_database.hpp"
+#include "preflop_tables.h"
+#include "rng.h"
+#include "split_eval.h"
+#include "state_table.hpp"
+#include "stats.h"
+#include "thread_pool.hpp"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
-#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
-static std::random_device rd;
-static std::mt19937 g(rd());
-static BitsetRankIndex hash{MAX_HASH_KEY, KEYS};
+static const BitsetRankIndex hash{MAX_HASH_KEY, KEYS};
 
-Evaluator::Evaluator()
-  : m_deck{initialize_deck()} {
-  m_deck_nodup.reserve(52);
-}
+namespace {
+  // Scratch used by queries that do not bring their own
+  thread_local EvalScratch thread_scratch;
 
-void Evaluator::simulate_flop(uint16_t* results) {
-  // Loop over all combos of turn and river
-  for (const auto& c : c45_2) {
-    uint32_t turn = m_deck_nodup[c[0]];
-    uint32_t river = m_deck_nodup[c[1]];
+  // Copy the known cards into the 7-card hands and collect the unseen cards
+  void prepare(const Situation& situation, EvalScratch& s) {
+    const auto& board = situation.board;
 
-    // Add turn and river to each hand
-    for (auto& hand : m_hands) {
-      hand[5] = turn;
-      hand[6] = river;
+    s.hands.clear();
+    for (const auto& hole : situation.hands) {
+      std::array<uint32_t, 7> hand{hole[0], hole[1], 0, 0, 0, 0, 0};
+      std::copy(board.begin(), board.end(), hand.begin() + 2);
+      s.hands.push_back(hand);
     }
 
-    // Evaluate each hand
-    for (const auto& hand : m_hands) {
-      *results++ = eval7(hash, hand);
+    // Populate the deck without known cards
+    CardSet known = situation.dead | CardSet(board.begin(), board.end());
+    for (const auto& hole : situation.hands) {
+      known.insert(hole[0]);
+      known.insert(hole[1]);
     }
+
+    s.deck.clear();
+    (CardSet::full() - known).for_each([&](uint32_t card) {
+      s.deck.push_back(card);
+    });
+    STATS_ADD(DECK_REBUILDS, 1);
   }
-}
 
-void Evaluator::simulate_turn(uint16_t* results) {
-  for (size_t i = 0; i < m_deck_nodup.size(); ++i) {
-    uint32_t river = m_deck_nodup[i];
+  /**
+   * Rankers split 7-card ranking in two steps: the board cards are folded
+   * into a `Partial` once per runout, and each player's `Hole` is then
+   * merged into it.
+   */
+  struct SplitRanker {
+    using Partial = HandSummary;
+    using Hole = HandSummary;
+
+    const SplitEvaluator& split;
+
+    Partial add(Partial partial, uint32_t card) const {
+      partial.add(card);
+      return partial;
+    }
+
+    Hole hole(const std::array<uint32_t, 2>& cards) const {
+      return add(add({}, cards[0]), cards[1]);
+    }
 
-    // Add river to each hand
-    for (auto& hand : m_hands) {
-      hand[6] = river;
+    uint16_t rank(const Partial& board, const Hole& hole) const {
+      return split.eval(board + hole);
     }
+  };
 
-    // Evaluate each hand
-    for (const auto& hand : m_hands) {
-      *results++ = eval7(hash, hand);
+  struct StateTableRanker {
+    using Partial = uint32_t;
+    using Hole = std::array<CardIndex, 2>;
+
+    const StateTable& table;
+
+    Partial add(Partial state, uint32_t card) const {
+      return table.next(state, card_index(card));
     }
+
+    Hole hole(const std::array<uint32_t, 2>& cards) const {
+      return {card_index(cards[0]), card_index(cards[1])};
+    }
+
+    uint16_t rank(Partial board, const Hole& hole) const {
+      STATS_ADD(EVAL7, 1);
+      return static_cast<uint16_t>(table.next(table.next(board, hole[0]), hole[1]));
+    }
+  };
+
+  template <typename Ranker>
+  using Holes = StaticVector<typename Ranker::Hole, MAX_PLAYERS>;
+
+  template <typename Ranker>
+  uint16_t* rank_hands(const Ranker& ranker, const typename Ranker::Partial& board,
+                       const Holes<Ranker>& holes, uint16_t* results) {
+    for (const auto& hole : holes) {
+      *results++ = ranker.rank(board, hole);
+    }
+    return results;
   }
-}
 
-size_t Evaluator::simulate(uint16_t* results, size_t num_simulations) {
-  assert(!m_hands.empty());
+  /**
+   * Runs the rows [0, rows) of an enumeration, handing f(begin, end) chunks
+   * to the pool when there is one and the rows rank at least `threshold`
+   * hands. Chunks write disjoint rows, so the split does not show in the
+   * results.
+   */
+  struct Enumeration {
+    ThreadPool* pool;
+    size_t threshold;
 
-  // Copy board cards to each hand
-  for (auto& hand : m_hands) {
-    for (size_t j = 0; j < m_board.size(); ++j) {
-      hand[2 + j] = m_board[j];
+    template <typename F>
+    void operator()(size_t rows, size_t hands_per_row, F&& f) const {
+      if (pool && rows * hands_per_row >= threshold) {
+        pool->parallel_for(rows, std::max<size_t>(1, rows / (4 * pool->num_threads())), f);
+      } else {
+        f(0, rows);
+      }
     }
+  };
+
+  // Rows `begin` to `end` of the turn and river pairs, in colex order of
+  // their positions in the deck. Each turn card is added once for all the
+  // rivers dealt with it.
+  template <typename Ranker>
+  void simulate_flop(const EvalScratch& s, const Ranker& ranker, typename Ranker::Partial flop,
+                     const Holes<Ranker>& holes, uint16_t* results, size_t begin, size_t end) {
+    results += begin * holes.size();
+    fold_combinations<2>(
+      begin, end, flop,
+      [&](const typename Ranker::Partial& board, uint8_t i) { return ranker.add(board, s.deck[i]); },
+      [&](const auto&, const typename Ranker::Partial& board) {
+        results = rank_hands(ranker, board, holes, results);
+      });
   }
 
-  // Populate the deck without known cards
-  m_deck_nodup.clear();
-  std::copy_if(m_deck.begin(), m_deck.end(), std::back_inserter(m_deck_nodup), [&](uint32_t card) {
-    return std::none_of(m_hands.begin(), m_hands.end(), [&, card](const auto& hand) {
-      return std::find(hand.begin(), hand.begin() + 2 + m_board.size(), card) != hand.begin() + 2 + m_board.size();
-    });
-  });
+  // Rows `begin` to `end` of the rivers
+  template <typename Ranker>
+  void simulate_turn(const EvalScratch& s, const Ranker& ranker, typename Ranker::Partial turn,
+                     const Holes<Ranker>& holes, uint16_t* results, size_t begin, size_t end) {
+    results += begin * holes.size();
+    for (size_t i = begin; i < end; ++i) {
+      results = rank_hands(ranker, ranker.add(turn, s.deck[i]), holes, results);
+    }
+  }
+
+  template <typename Ranker>
+  size_t simulate_board(const Situation& situation, EvalScratch& s, uint16_t* results, size_t num_simulations,
+                        uint64_t seed, uint64_t first_simulation, const Ranker& ranker,
+                        const Enumeration& enumerate) {
+    // Work shared by all hands: the known board, folded once
+    typename Ranker::Partial board{};
+    for (uint32_t card : situation.board) {
+      board = ranker.add(board, card);
+    }
+
+    Holes<Ranker> holes;
+    for (const auto& hole : situation.hands) {
+      holes.push_back(ranker.hole(hole));
+    }
+
+    const size_t board_size = situation.board.size();
+
+    if (board_size == 3) {
+      // Board has flop, simulate every pair of turn and river (990 heads-up)
+      const size_t runouts = binomial(static_cast<unsigned>(s.deck.size()), 2);
+      enumerate(runouts, holes.size(), [&](size_t begin, size_t end) {
+        simulate_flop(s, ranker, board, holes, results, begin, end);
+      });
+      return runouts;
+    } else if (board_size == 4) {
+      // Board has flop and turn, simulate every possible river (44 heads-up)
+      enumerate(s.deck.size(), holes.size(), [&](size_t begin, size_t end) {
+        simulate_turn(s, ranker, board, holes, results, begin, end);
+      });
+      return s.deck.size();
+    } else if (board_size == 5) {
+      // Board is complete, evaluate each hand once
+      rank_hands(ranker, board, holes, results);
+      return 1;
+    }
+
+    // When no board is set, use montecarlo sampling
+    const size_t cards_to_deal = 5 - board_size;
+    std::array<size_t, 5> swapped;
+
+    for (size_t i = 0; i < num_simulations; ++i) {
+      Philox4x32 rng(seed, first_simulation + i);
+
+      // Deal cards with a partial Fisher-Yates shuffle
+      auto runout = board;
+      for (size_t j = 0; j < cards_to_deal; ++j) {
+        swapped[j] = j + rng.bounded(s.deck.size() - j);
+        std::swap(s.deck[j], s.deck[swapped[j]]);
+        runout = ranker.add(runout, s.deck[j]);
+      }
+
+      results = rank_hands(ranker, runout, holes, results);
+
+      // Restore the deck so that each simulation only depends on its own stream
+      for (size_t j = cards_to_deal; j-- > 0;) {
+        std::swap(s.deck[j], s.deck[swapped[j]]);
+      }
+    }
+
+    return num_simulations;
+  }
+
+  // Deals won and tied by the first hand
+  struct Tally {
+    uint64_t wins{0};
+    uint64_t ties{0};
+
+    void add(uint16_t rank, uint16_t best_other) {
+      wins += rank < best_other;
+      ties += rank == best_other;
+    }
+  };
+
+  /**
+   * Every runout of the board against every hand of one random opponent.
+   * Rows are the runouts, as in `simulate_board`: each ranks the known hands
+   * once, then each pair of the cards left as the opponent's hand.
+   */
+  template <typename Ranker>
+  uint64_t enumerate_vs_one(const Situation& situation, const EvalScratch& s, const Ranker& ranker,
+                            const Enumeration& enumerate, Tally& tally) {
+    typename Ranker::Partial board{};
+    for (uint32_t card : situation.board) {
+      board = ranker.add(board, card);
+    }
+
+    Holes<Ranker> holes;
+    for (const auto& hole : situation.hands) {
+      holes.push_back(ranker.hole(hole));
+    }
+
+    const auto& deck = s.deck;
+    const size_t board_size = situation.board.size();
+    const uint64_t opponent_hands = binomial(static_cast<unsigned>(deck.size() + board_size - 5), 2);
+
+    // Deals of the runout whose cards are at positions `a` and `b` of the deck
+    // (past its end when not dealt)
+    auto count = [&](const typename Ranker::Partial& runout, size_t a, size_t b, Tally& counts) {
+      const uint16_t rank = ranker.rank(runout, holes[0]);
+      uint16_t best_known = 7463;
+      for (size_t p = 1; p < holes.size(); ++p) {
+        best_known = std::min(best_known, ranker.rank(runout, holes[p]));
+      }
+      if (best_known < rank) {
+        // Lost whatever the opponent holds
+        return;
+      }
+      for (size_t j = 1; j < deck.size(); ++j) {
+        if (j == a || j == b) continue;
+        for (size_t i = 0; i < j; ++i) {
+          if (i == a || i == b) continue;
+          counts.add(rank, std::min(best_known, ranker.rank(runout, ranker.hole({deck[i], deck[j]}))));
+        }
+      }
+    };
+
+    // Merged once per chunk
+    std::atomic<uint64_t> wins{0};
+    std::atomic<uint64_t> ties{0};
+    auto merge = [&](const Tally& counts) {
+      wins += counts.wins;
+      ties += counts.ties;
+    };
+
+    uint64_t runouts = 1;
+    if (board_size == 3) {
+      runouts = binomial(static_cast<unsigned>(deck.size()), 2);
+      enumerate(runouts, opponent_hands, [&](size_t begin, size_t end) {
+        Tally counts;
+        fold_combinations<2>(
+          begin, end, board,
+          [&](const typename Ranker::Partial& partial, uint8_t i) { return ranker.add(partial, deck[i]); },
+          [&](const auto& c, const typename Ranker::Partial& runout) { count(runout, c[0], c[1], counts); });
+        merge(counts);
+      });
+    } else if (board_size == 4) {
+      runouts = deck.size();
+      enumerate(runouts, opponent_hands, [&](size_t begin, size_t end) {
+        Tally counts;
+        for (size_t i = begin; i < end; ++i) {
+          count(ranker.add(board, deck[i]), i, deck.size(), counts);
+        }
+        merge(counts);
+      });
+    } else {
+      Tally counts;
+      count(board, deck.size(), deck.size(), counts);
+      merge(counts);
+    }
+
+    tally.wins = wins;
+    tally.ties = ties;
+    return runouts * opponent_hands;
+  }
+
+  /**
+   * Monte Carlo sampling of the runout and the opponents' hands, all dealt
+   * from the deck with one partial shuffle per simulation.
+   */
+  template <typename Ranker>
+  uint64_t sample_vs_random(const Situation& situation, EvalScratch& s, const Ranker& ranker,
+                            size_t num_opponents, size_t num_simulations, uint64_t seed, Tally& tally) {
+    typename Ranker::Partial board{};
+    for (uint32_t card : situation.board) {
+      board = ranker.add(board, card);
+    }
+
+    Holes<Ranker> holes;
+    for (const auto& hole : situation.hands) {
+      holes.push_back(ranker.hole(hole));
+    }
+
+    auto& deck = s.deck;
+    const size_t runout_cards = 5 - situation.board.size();
+    const size_t cards_to_deal = runout_cards + 2 * num_opponents;
+    std::array<size_t, 52> swapped;
+
+    for (size_t i = 0; i < num_simulations; ++i) {
+      Philox4x32 rng(seed, i);
+
+      for (size_t j = 0; j < cards_to_deal; ++j) {
+        swapped[j] = j + rng.bounded(deck.size() - j);
+        std::swap(deck[j], deck[swapped[j]]);
+      }
+
+      auto runout = board;
+      for (size_t j = 0; j < runout_cards; ++j) {
+        runout = ranker.add(runout, deck[j]);
+      }
+
+      uint16_t best_other = 7463;
+      for (size_t p = 1; p < holes.size(); ++p) {
+        best_other = std::min(best_other, ranker.rank(runout, holes[p]));
+      }
+      for (size_t j = runout_cards; j < cards_to_deal; j += 2) {
+        best_other = std::min(best_other, ranker.rank(runout, ranker.hole({deck[j], deck[j + 1]})));
+      }
+      tally.add(ranker.rank(runout, holes[0]), best_other);
+
+      for (size_t j = cards_to_deal; j-- > 0;) {
+        std::swap(deck[j], deck[swapped[j]]);
+      }
+    }
+
+    return num_simulations;
+  }
+
+  // Rank of the best 5-card hand among the first `num_cards` cards of `hand`
+  uint16_t eval_partial(const std::array<uint32_t, 7>& hand, size_t num_cards) {
+    if (num_cards == 5) {
+      return eval5(hash, {hand[0], hand[1], hand[2], hand[3], hand[4]});
+    }
+    if (num_cards == 6) {
+      return eval6(hash, {hand[0], hand[1], hand[2], hand[3], hand[4], hand[5]});
+    }
+    return split_evaluator().eval7(hand);
+  }
+
+  // Where the first hand stands against a combo of the range
+  enum Standing { AHEAD, TIED, BEHIND };
+
+  Standing standing(uint16_t rank, uint16_t other) {
+    return rank < other ? AHEAD : rank == other ? TIED : BEHIND;
+  }
+
+  struct PotentialCombo {
+    std::array<uint32_t, 2> cards;
+    CardSet card_set;
+    float weight;
+    Standing now;
+  };
+
+  /**
+   * Working memory of `potential` queries: the combos of the range left by
+   * the known cards, and the weight of the combos moving from one standing
+   * to another (now * 3 + then) on each runout.
+   */
+  struct PotentialScratch {
+    std::vector<PotentialCombo> combos;
+    std::vector<std::array<double, 9>> rows;
+  };
+
+  thread_local PotentialScratch potential_scratch;
+
+  // One row per runout, as in `simulate_board`
+  template <typename Ranker>
+  void potential_rows(const Situation& situation, const EvalScratch& s, PotentialScratch& p,
+                      const Ranker& ranker, const Enumeration& enumerate) {
+    typename Ranker::Partial board{};
+    for (uint32_t card : situation.board) {
+      board = ranker.add(board, card);
+    }
+    const auto hole = ranker.hole(situation.hands[0]);
+
+    // The combos' holes, converted once for all the runouts. Pool threads
+    // read the calling thread's through the reference.
+    thread_local std::vector<typename Ranker::Hole> thread_holes;
+    auto& holes = thread_holes;
+    holes.clear();
+    for (const auto& combo : p.combos) {
+      holes.push_back(ranker.hole(combo.cards));
+    }
+
+    auto count = [&](const typename Ranker::Partial& runout, CardSet runout_cards, std::array<double, 9>& row) {
+      row.fill(0);
+      const uint16_t rank = ranker.rank(runout, hole);
+      for (size_t i = 0; i < p.combos.size(); ++i) {
+        const auto& combo = p.combos[i];
+        if (combo.card_set.intersects(runout_cards)) continue;
+        row[combo.now * 3 + standing(rank, ranker.rank(runout, holes[i]))] += combo.weight;
+      }
+    };
+
+    const auto& deck = s.deck;
+    const size_t board_size = situation.board.size();
+
+    if (board_size == 3) {
+      p.rows.resize(binomial(static_cast<unsigned>(deck.size()), 2));
+      enumerate(p.rows.size(), p.combos.size(), [&](size_t begin, size_t end) {
+        auto* row = p.rows.data() + begin;
+        fold_combinations<2>(
+          begin, end, board,
+          [&](const typename Ranker::Partial& partial, uint8_t i) { return ranker.add(partial, deck[i]); },
+          [&](const auto& c, const typename Ranker::Partial& runout) {
+            std::array<uint32_t, 2> cards = {deck[c[0]], deck[c[1]]};
+            count(runout, CardSet(cards.begin(), cards.end()), *row++);
+          });
+      });
+    } else if (board_size == 4) {
+      p.rows.resize(deck.size());
+      enumerate(p.rows.size(), p.combos.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          count(ranker.add(board, deck[i]), CardSet(&deck[i], &deck[i] + 1), p.rows[i]);
+        }
+      });
+    } else {
+      p.rows.resize(1);
+      count(board, CardSet(), p.rows[0]);
+    }
+  }
 
-  if (m_board.size() == 3) {
-    // Board has flop, simulate 990 combos of turn and river
-    simulate_flop(results);
-    return 990;
-  } else if (m_board.size() == 4) {
-    // Board has flop and turn, simulate 44 possible rivers
-    simulate_turn(results);
-    return 44;
-  } else if (m_board.size() == 5) {
-    // Board is complete, evaluate each hand once
-    for (const auto& hand : m_hands) {
-      *results++ = eval7(hash, hand);
+  template <typename Hands>
+  uint32_t leaders(const Hands& hands, size_t num_cards) {
+    uint32_t mask = 0;
+    uint16_t best = 7463;
+    for (size_t i = 0; i < hands.size(); ++i) {
+      auto rank = eval_partial(hands[i], num_cards);
+      if (rank < best) {
+        best = rank;
+        mask = 0;
+      }
+      if (rank == best) {
+        mask |= 1u << i;
+      }
     }
-    return 1;
+    return mask;
   }
+}
+
+Evaluator::Evaluator(uint64_t seed)
+  : m_seed{seed} {}
+
+size_t Evaluator::simulate(const Situation& situation, uint16_t* results, size_t num_simulations,
+                           uint64_t first_simulation) const {
+  return simulate(situation, thread_scratch, results, num_simulations, first_simulation);
+}
+
+size_t Evaluator::simulate(const Situation& situation, EvalScratch& s, uint16_t* results,
+                           size_t num_simulations, uint64_t first_simulation) const {
+  assert(!situation.hands.empty());
+
+  {
+    STATS_TIME(SETUP_NS);
+    prepare(situation, s);
+  }
+
+  STATS_TIME(SIMULATE_NS);
+  const Enumeration enumerate{m_thread_pool.get(), m_parallel_threshold};
+  size_t simulations_done = m_state_table
+    ? simulate_board(situation, s, results, num_simulations, m_seed, first_simulation,
+                     StateTableRanker{*m_state_table}, enumerate)
+    : simulate_board(situation, s, results, num_simulations, m_seed, first_simulation,
+                     SplitRanker{split_evaluator()}, enumerate);
+  STATS_ADD(SIMULATIONS, simulations_done);
+  return simulations_done;
+}
+
+OutsResult Evaluator::outs(const Situation& situation) const {
+  return outs(situation, thread_scratch);
+}
+
+OutsResult Evaluator::outs(const Situation& situation, EvalScratch& s) const {
+  assert(!situation.hands.empty());
+  assert(situation.board.size() == 3 || situation.board.size() == 4);
+
+  prepare(situation, s);
+
+  auto& hands = s.hands;
+  const auto& deck = s.deck;
+  const size_t num_cards = 2 + situation.board.size();
+  const uint32_t all_players = (1u << hands.size()) - 1;
+
+  OutsResult result;
+  result.leaders = leaders(hands, num_cards);
+  result.players.resize(hands.size());
+
+  // Players seen winning or tying on at least one complete runout
+  uint32_t alive = 0;
 
-  // When no board is set, use montecarlo sampling
-  for (size_t i = 0; i < num_simulations; ++i) {
-    // Shuffle the deck
-    // TODO: Check if a simpler shuffle is significantly faster
-    // TODO: Maybe use the whole deck before reshuffling
-    std::shuffle(m_deck_nodup.begin(), m_deck_nodup.end(), g);
-    int cards_to_deal = 5 - m_board.size();
-    int num_cards = 2 + m_board.size();
+  for (size_t i = 0; i < deck.size(); ++i) {
+    uint32_t card = deck[i];
+    for (auto& hand : hands) {
+      hand[num_cards] = card;
+    }
+
+    uint32_t next = leaders(hands, num_cards + 1);
+    result.cards.push_back({card, next});
+
+    for (size_t p = 0; p < hands.size(); ++p) {
+      uint32_t bit = 1u << p;
+      if (next == bit && result.leaders != bit) {
+        ++result.players[p].outs;
+      } else if ((next & bit) && next != bit) {
+        ++result.players[p].tie_outs;
+      }
+    }
+
+    if (num_cards == 6) {
+      // The river completes the board
+      alive |= next;
+      continue;
+    }
+
+    // On the flop, look at rivers for players who just lost the lead and
+    // for players not yet known to be live
+    uint32_t lost = result.leaders & ~next;
+    uint32_t regained = 0;
+    uint32_t pending = lost | (all_players & ~alive);
+
+    for (size_t j = 0; j < deck.size() && pending; ++j) {
+      if (j == i) continue;
+      for (auto& hand : hands) {
+        hand[6] = deck[j];
+      }
+      uint32_t final_leaders = leaders(hands, 7);
+      alive |= final_leaders;
+      regained |= lost & final_leaders;
+      pending &= ~final_leaders;
+    }
 
-    // Deal cards from shuffled deck
-    for (int j = 0; j < cards_to_deal; ++j) {
-      uint32_t card = m_deck_nodup[j];
-      for (auto& hand : m_hands) {
-        hand[num_cards] = card;
+    for (size_t p = 0; p < hands.size(); ++p) {
+      if (regained & (1u << p)) {
+        ++result.players[p].redraws;
       }
-      ++num_cards;
     }
+  }
+
+  for (size_t p = 0; p < hands.size(); ++p) {
+    result.players[p].drawing_dead = !(alive & (1u << p));
+  }
+
+  return result;
+}
+
+HandPotential Evaluator::potential(const Situation& situation, const HandRange& range) const {
+  assert(!situation.hands.empty());
+  assert(situation.board.size() >= 3);
+
+  EvalScratch& s = thread_scratch;
+  PotentialScratch& p = potential_scratch;
+
+  {
+    STATS_TIME(SETUP_NS);
+    prepare(situation, s);
+  }
+
+  // Standings on the current board
+  const size_t num_cards = 2 + situation.board.size();
+  const CardSet known = CardSet::full() - CardSet(s.deck.begin(), s.deck.end());
+  auto hand = s.hands[0];
+  const uint16_t rank = eval_partial(hand, num_cards);
+
+  p.combos.clear();
+  double strength = 0;
+  double weight = 0;
+  for (const auto& [cards, combo_weight] : range.hands()) {
+    if (combo_weight == 0.f || known.contains(cards.first) || known.contains(cards.second)) continue;
+
+    hand[0] = cards.first;
+    hand[1] = cards.second;
+    PotentialCombo combo{{cards.first, cards.second}, {}, combo_weight, standing(rank, eval_partial(hand, num_cards))};
+    combo.card_set = CardSet(combo.cards.begin(), combo.cards.end());
+    p.combos.push_back(combo);
+
+    strength += combo.now == AHEAD ? combo_weight : combo.now == TIED ? combo_weight / 2.0 : 0.0;
+    weight += combo_weight;
+  }
+
+  HandPotential result;
+  if (p.combos.empty()) {
+    return result;
+  }
+
+  {
+    STATS_TIME(SIMULATE_NS);
+    const Enumeration enumerate{m_thread_pool.get(), m_parallel_threshold};
+    if (m_state_table) {
+      potential_rows(situation, s, p, StateTableRanker{*m_state_table}, enumerate);
+    } else {
+      potential_rows(situation, s, p, SplitRanker{split_evaluator()}, enumerate);
+    }
+    STATS_ADD(SIMULATIONS, p.rows.size());
+  }
 
-    // Evaluate each hand
-    for (const auto& hand : m_hands) {
-      *results++ = eval7(hash, hand);
+  // Reduce the rows in order, so that the split does not show
+  STATS_TIME(REDUCE_NS);
+  std::array<double, 9> transitions{};
+  double ehs = 0;
+  double ehs2 = 0;
+  size_t runouts = 0;
+  for (const auto& row : p.rows) {
+    double then[3] = {0, 0, 0};
+    for (int now = 0; now < 3; ++now) {
+      for (int later = 0; later < 3; ++later) {
+        transitions[now * 3 + later] += row[now * 3 + later];
+        then[later] += row[now * 3 + later];
+      }
     }
+    double total = then[AHEAD] + then[TIED] + then[BEHIND];
+    if (total == 0) continue;
+
+    double final_strength = (then[AHEAD] + then[TIED] / 2) / total;
+    ehs += final_strength;
+    ehs2 += final_strength * final_strength;
+    ++runouts;
   }
 
-  return num_simulations;
+  auto t = [&](Standing now, Standing then) { return transitions[now * 3 + then]; };
+  auto from = [&](Standing now) { return t(now, AHEAD) + t(now, TIED) + t(now, BEHIND); };
+  double behind = from(BEHIND) + from(TIED) / 2;
+  double ahead = from(AHEAD) + from(TIED) / 2;
+
+  result.hand_strength = static_cast<float>(strength / weight);
+  result.ehs = runouts ? static_cast<float>(ehs / runouts) : 0.f;
+  result.ehs2 = runouts ? static_cast<float>(ehs2 / runouts) : 0.f;
+  if (behind > 0) {
+    result.ppot = static_cast<float>((t(BEHIND, AHEAD) + t(BEHIND, TIED) / 2 + t(TIED, AHEAD) / 2) / behind);
+  }
+  if (ahead > 0) {
+    result.npot = static_cast<float>((t(AHEAD, BEHIND) + t(TIED, BEHIND) / 2 + t(AHEAD, TIED) / 2) / ahead);
+  }
+
+  return result;
 }
 
-EvalResult Evaluator::evaluate() {
-  m_results.assign(m_num_simulations * m_hands.size(), 0);
+EvalResult Evaluator::evaluate(const Situation& situation) const {
+  return evaluate(situation, thread_scratch);
+}
+
+EvalResult Evaluator::evaluate(const Situation& situation, EvalScratch& scratch) const {
+  const size_t num_hands = situation.hands.size();
+  const auto& board = situation.board;
+
+  // The first hand is compared with the best of the others
+  if (num_hands < 2) {
+    throw std::invalid_argument("Evaluation needs at least two hands");
+  }
+
+  if (m_flop_database && num_hands == 2 && board.size() == 3 && situation.dead.empty()) {
+    if (auto result = m_flop_database->lookup(situation.hands[0], situation.hands[1], {board[0], board[1], board[2]})) {
+      return *result;
+    }
+  }
+
+  // Enumerating a flop fills up to 990 rows (heads-up) whatever the number
+  // of simulations
+  auto& results = scratch.results;
+  size_t capacity = std::max<size_t>(m_num_simulations, 990) * num_hands;
+  if (results.size() < capacity) {
+    results.resize(capacity);
+  }
 
-  size_t simulations_done = simulate(m_results.data(), m_num_simulations);
+  size_t simulations_done = simulate(situation, scratch, results.data(), m_num_simulations);
 
   // Calculate results
-  int num_wins = 0;
-  int num_ties = 0;
+  // Count in chunks, each merging its totals once
+  STATS_TIME(REDUCE_NS);
+  std::atomic<int> num_wins{0};
+  std::atomic<int> num_ties{0};
 
-  for (size_t i = 0; i < simulations_done; ++i) {
-    auto res1 = m_results[i * m_hands.size() + 0];
-    auto res2 = m_results[i * m_hands.size() + 1];
-    if (res1 < res2) {
-      ++num_wins;
-    } else if (res1 == res2) {
-      ++num_ties;
+  const Enumeration enumerate{m_thread_pool.get(), m_parallel_threshold};
+  enumerate(simulations_done, num_hands, [&](size_t begin, size_t end) {
+    int wins = 0;
+    int ties = 0;
+    for (size_t i = begin; i < end; ++i) {
+      const uint16_t* ranks = results.data() + i * num_hands;
+      uint16_t best_other = *std::min_element(ranks + 1, ranks + num_hands);
+      if (ranks[0] < best_other) {
+        ++wins;
+      } else if (ranks[0] == best_other) {
+        ++ties;
+      }
+    }
+    num_wins += wins;
+    num_ties += ties;
+  });
+
+  EvalResult result;
+
+  result.win_prob = static_cast<float>(num_wins.load()) / static_cast<float>(simulations_done);
+  result.tie_prob = static_cast<float>(num_ties.load()) / static_cast<float>(simulations_done);
+
+  return result;
+}
+
+EvalResult Evaluator::evaluate_vs_random(const Situation& situation, size_t num_opponents) const {
+  return evaluate_vs_random(situation, num_opponents, thread_scratch);
+}
+
+EvalResult Evaluator::evaluate_vs_random(const Situation& situation, size_t num_opponents,
+                                         EvalScratch& scratch) const {
+  assert(!situation.hands.empty());
+
+  const size_t num_hands = situation.hands.size();
+  const size_t board_size = situation.board.size();
+
+  if (num_opponents == 0 || num_hands + num_opponents > MAX_PLAYERS) {
+    throw std::invalid_argument("Invalid number of random opponents");
+  }
+
+  if (m_preflop_tables && num_hands == 1 && board_size == 0 && situation.dead.empty()) {
+    if (auto result = preflop_vs_random(situation.hands[0][0], situation.hands[0][1], num_opponents)) {
+      return *result;
     }
   }
 
+  {
+    STATS_TIME(SETUP_NS);
+    prepare(situation, scratch);
+  }
+
+  if (scratch.deck.size() < 5 - board_size + 2 * num_opponents) {
+    throw std::invalid_argument("Not enough cards left to deal the random opponents");
+  }
+
+  STATS_TIME(SIMULATE_NS);
+  const Enumeration enumerate{m_thread_pool.get(), m_parallel_threshold};
+  Tally tally;
+  auto run = [&](const auto& ranker) -> uint64_t {
+    if (num_opponents == 1 && board_size >= 3) {
+      return enumerate_vs_one(situation, scratch, ranker, enumerate, tally);
+    }
+    return sample_vs_random(situation, scratch, ranker, num_opponents, m_num_simulations, m_seed, tally);
+  };
+  uint64_t deals = m_state_table ? run(StateTableRanker{*m_state_table}) : run(SplitRanker{split_evaluator()});
+  STATS_ADD(SIMULATIONS, deals);
+
   EvalResult result;
 
-  result.win_prob = static_cast<float>(num_wins) / static_cast<float>(simulations_done);
-  result.tie_prob = static_cast<float>(num_ties) / static_cast<float>(simulations_done);
+  result.win_prob = static_cast<float>(static_cast<double>(tally.wins) / static_cast<double>(deals));
+  result.tie_prob = static_cast<float>(static_cast<double>(tally.ties) / static_cast<double>(deals));
 
   return result;
 }
@@ -0,0 +1,288 @@
+#include "flop_database.hpp"
+#include "board_classes.hpp"
+#include "card_index.h"
+#include "split_eval.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+  constexpr char MAGIC[8] = {'P', 'E', 'F', 'L', 'O', 'P', 'D', '1'};
+
+  constexpr size_t NUM_FLOPS = FlopDatabase::NUM_FLOPS;
+  constexpr int RUNOUTS = 990;
+
+  // Hole-card combos of the 49 cards left by a flop, and pairs of them
+  constexpr size_t NUM_COMBOS = 49 * 48 / 2;
+  constexpr size_t NUM_ENTRIES = NUM_COMBOS * (NUM_COMBOS - 1) / 2;
+
+  // 20 bits per entry, padded so that every entry can be read as 4 bytes
+  constexpr size_t CHUNK_BYTES = (NUM_ENTRIES * 20 / 8 + 4 + 7) / 8 * 8;
+  constexpr size_t HEADER_BYTES = 4096;
+  constexpr size_t FILE_BYTES = HEADER_BYTES + NUM_FLOPS * CHUNK_BYTES;
+
+  struct FileHeader {
+    char magic[8];
+    uint32_t num_flops;
+    uint32_t chunk_bytes;
+    uint8_t present[NUM_FLOPS];
+  };
+  static_assert(sizeof(FileHeader) <= HEADER_BYTES);
+
+  // Index of the pair i < j in colex order, for cards as well as for combos
+  size_t pair_index(size_t i, size_t j) {
+    return j * (j - 1) / 2 + i;
+  }
+
+  // Representative of a class of flops, in increasing card index order
+  std::array<CardIndex, 3> canonical_cards(size_t flop) {
+    auto board = BoardClasses::of(3).board(flop);
+    return {card_index(board[0]), card_index(board[1]), card_index(board[2])};
+  }
+
+  // Position of `card` among the 49 cards outside the sorted `flop`
+  size_t position(CardIndex card, const std::array<CardIndex, 3>& flop) {
+    return card - (flop[0] < card) - (flop[1] < card) - (flop[2] < card);
+  }
+
+  size_t combo_index(CardIndex first, CardIndex second, const std::array<CardIndex, 3>& flop) {
+    size_t i = position(first, flop);
+    size_t j = position(second, flop);
+    return i < j ? pair_index(i, j) : pair_index(j, i);
+  }
+
+  /**
+   * Outcomes of every pair of combos on one flop.
+   *
+   * Each of the 1176 turn and river pairs is dealt once: all the combos are
+   * ranked on that board, and every pair of combos compared. Combos holding
+   * the turn or the river are marked dead, so every pair accumulates exactly
+   * the 990 runouts it can see.
+   */
+  std::vector<uint8_t> compute_chunk(size_t flop) {
+    const auto cards = canonical_cards(flop);
+    const auto& split = split_evaluator();
+
+    std::array<CardIndex, 49> rest{};
+    for (CardIndex card = 0, n = 0; card < 52; ++card) {
+      if (card != cards[0] && card != cards[1] && card != cards[2]) {
+        rest[n++] = card;
+      }
+    }
+
+    std::vector<std::array<size_t, 2>> combos(NUM_COMBOS);
+    std::vector<HandSummary> holes(NUM_COMBOS);
+    for (size_t j = 1; j < rest.size(); ++j) {
+      for (size_t i = 0; i < j; ++i) {
+        combos[pair_index(i, j)] = {i, j};
+        holes[pair_index(i, j)].add(card_at(rest[i]));
+        holes[pair_index(i, j)].add(card_at(rest[j]));
+      }
+    }
+
+    HandSummary flop_summary;
+    for (CardIndex card : cards) {
+      flop_summary.add(card_at(card));
+    }
+
+    constexpr uint16_t DEAD = 0xffff;
+    std::vector<uint16_t> ranks(NUM_COMBOS);
+    std::vector<uint16_t> wins(NUM_ENTRIES);
+    std::vector<uint16_t> ties(NUM_ENTRIES);
+
+    for (size_t river = 1; river < rest.size(); ++river) {
+      for (size_t turn = 0; turn < river; ++turn) {
+        HandSummary board = flop_summary;
+        board.add(card_at(rest[turn]));
+        board.add(card_at(rest[river]));
+
+        for (size_t c = 0; c < NUM_COMBOS; ++c) {
+          const auto& [i, j] = combos[c];
+          bool dead = i == turn || i == river || j == turn || j == river;
+          ranks[c] = dead ? DEAD : split.eval(board + holes[c]);
+        }
+
+        // A dead first combo neither wins nor ties
+        for (size_t c = 1; c < NUM_COMBOS; ++c) {
+          uint16_t rank = ranks[c];
+          if (rank == DEAD) continue;
+          uint16_t* w = wins.data() + pair_index(0, c);
+          uint16_t* t = ties.data() + pair_index(0, c);
+          for (size_t other = 0; other < c; ++other) {
+            w[other] += ranks[other] < rank;
+            t[other] += ranks[other] == rank;
+          }
+        }
+      }
+    }
+
+    // Pack, leaving pairs of combos sharing a card empty
+    std::vector<uint8_t> chunk(CHUNK_BYTES);
+    for (size_t c = 1; c < NUM_COMBOS; ++c) {
+      for (size_t other = 0; other < c; ++other) {
+        const auto& [a, b] = combos[c];
+        const auto& [x, y] = combos[other];
+        if (a == x || a == y || b == x || b == y) continue;
+
+        size_t entry = pair_index(other, c);
+        assert(wins[entry] + ties[entry] <= RUNOUTS);
+        uint32_t value = (uint32_t(wins[entry]) | uint32_t(ties[entry]) << 10) << ((entry & 1) * 4);
+        size_t byte = entry * 20 / 8;
+        for (size_t k = 0; k < 3; ++k) {
+          chunk[byte + k] |= static_cast<uint8_t>(value >> (8 * k));
+        }
+      }
+    }
+    return chunk;
+  }
+
+  bool valid_header(const FileHeader& header) {
+    return std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+           header.num_flops == NUM_FLOPS && header.chunk_bytes == CHUNK_BYTES;
+  }
+}
+
+size_t FlopDatabase::generate(const std::string& path, const GenerateOptions& options) {
+  if (options.first_flop > options.last_flop || options.last_flop >= NUM_FLOPS) {
+    throw std::invalid_argument("Invalid flop range");
+  }
+
+  FileWriter file(path, "flop database", false);
+
+  std::vector<size_t> todo;
+  FileHeader header{};
+  if (file.size() == 0) {
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.num_flops = NUM_FLOPS;
+    header.chunk_bytes = CHUNK_BYTES;
+    file.write_at(&header, sizeof(header), 0);
+    file.resize(FILE_BYTES);
+  } else {
+    if (file.size() != FILE_BYTES) {
+      throw std::runtime_error("Invalid flop database: " + path);
+    }
+    file.read_at(&header, sizeof(header), 0);
+    if (!valid_header(header)) {
+      throw std::runtime_error("Invalid flop database: " + path);
+    }
+  }
+
+  for (size_t flop = options.first_flop; flop <= options.last_flop; ++flop) {
+    if (!header.present[flop]) {
+      todo.push_back(flop);
+    }
+  }
+
+  // Workers take the next missing flop until none is left or one fails
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> done{0};
+  std::mutex error_mutex;
+  std::exception_ptr error;
+
+  auto work = [&] {
+    try {
+      for (size_t k; (k = next++) < todo.size();) {
+        size_t flop = todo[k];
+        auto chunk = compute_chunk(flop);
+        file.write_at(chunk.data(), chunk.size(), HEADER_BYTES + flop * CHUNK_BYTES);
+
+        // Flag the chunk only once it is on disk
+        const uint8_t present = 1;
+        file.sync();
+        file.write_at(&present, 1, offsetof(FileHeader, present) + flop);
+
+        size_t count = ++done;
+        if (options.progress) {
+          options.progress(flop, count, todo.size());
+        }
+      }
+    } catch (...) {
+      std::lock_guard lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      next = todo.size();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < std::min(options.num_threads, todo.size()); ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  file.sync();
+  return todo.size();
+}
+
+FlopDatabase FlopDatabase::load(const std::string& path) {
+  FlopDatabase database;
+  database.m_file = MappedFile(path, "flop database");
+  const auto* header = database.m_file.as<FileHeader>();
+  if (database.m_file.size() != FILE_BYTES || !valid_header(*header)) {
+    throw std::runtime_error("Invalid flop database: " + path);
+  }
+  // Each lookup reads a few bytes at a random place
+  database.m_file.advise_random();
+
+  database.m_present = header->present;
+  database.m_chunks = database.m_file.as<uint8_t>(HEADER_BYTES);
+  return database;
+}
+
+std::array<uint32_t, 3> FlopDatabase::canonical_flop(size_t flop) {
+  assert(flop < NUM_FLOPS);
+  return to_cards(canonical_cards(flop));
+}
+
+size_t FlopDatabase::size() const {
+  return static_cast<size_t>(std::count(m_present, m_present + NUM_FLOPS, 1));
+}
+
+std::optional<EvalResult> FlopDatabase::lookup(const std::array<uint32_t, 2>& hero,
+                                               const std::array<uint32_t, 2>& villain,
+                                               const std::array<uint32_t, 3>& flop) const {
+  const auto canonical = BoardClasses::of(3).classify({flop[0], flop[1], flop[2]});
+  if (!m_present[canonical.index]) {
+    return std::nullopt;
+  }
+
+  const auto& suits = canonical.suits;
+  const auto cards = canonical_cards(canonical.index);
+  size_t h = combo_index(card_index(BoardClasses::permute(hero[0], suits)),
+                         card_index(BoardClasses::permute(hero[1], suits)), cards);
+  size_t v = combo_index(card_index(BoardClasses::permute(villain[0], suits)),
+                         card_index(BoardClasses::permute(villain[1], suits)), cards);
+  assert(h != v);
+
+  size_t index = h < v ? pair_index(h, v) : pair_index(v, h);
+  uint32_t value;
+  std::memcpy(&value, m_chunks + canonical.index * CHUNK_BYTES + index * 20 / 8, sizeof(value));
+  value >>= (index & 1) * 4;
+
+  int wins = value & 0x3ff;
+  int ties = (value >> 10) & 0x3ff;
+  if (h > v) {
+    // Entries count the wins of the combo of lower index
+    wins = RUNOUTS - wins - ties;
+  }
+
+  EvalResult result;
+  result.win_prob = static_cast<float>(wins) / static_cast<float>(RUNOUTS);
+  result.tie_prob = static_cast<float>(ties) / static_cast<float>(RUNOUTS);
+  return result;
+}
@@ -0,0 +1,78 @@
+// Generates the heads-up flop equity database read by `FlopDatabase`.
+//
+//   flop_db_gen FILE [--threads N] [--flops FIRST-LAST]
+//
+// Only the flops missing from FILE are computed, so an interrupted run picks
+// up where it stopped, and the work can be split in ranges of flops (0 to
+// 1754) across runs.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "flop_database.hpp"
+#include "utils.h"
+
+namespace {
+  void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " FILE [--threads N] [--flops FIRST-LAST]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --threads N           Worker threads (default: one per core)\n";
+    std::cout << "  --flops FIRST-LAST    Only compute these flops (default: 0-"
+              << FlopDatabase::NUM_FLOPS - 1 << ")\n";
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::string path;
+  FlopDatabase::GenerateOptions options;
+  options.num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg == "--threads" && i + 1 < argc) {
+        options.num_threads = std::stoul(argv[++i]);
+      } else if (arg == "--flops" && i + 1 < argc) {
+        std::string range = argv[++i];
+        size_t dash = range.find('-');
+        options.first_flop = std::stoul(range.substr(0, dash));
+        options.last_flop = dash == std::string::npos ? options.first_flop : std::stoul(range.substr(dash + 1));
+      } else if (path.empty() && arg[0] != '-') {
+        path = arg;
+      } else {
+        path.clear();
+        break;
+      }
+    }
+  } catch (const std::exception&) {
+    path.clear();
+  }
+
+  if (path.empty() || options.num_threads == 0) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  std::mutex output_mutex;
+  auto start = std::chrono::steady_clock::now();
+  options.progress = [&](size_t flop, size_t done, size_t total) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::lock_guard lock(output_mutex);
+    std::cerr << "\r" << done << "/" << total << " flops, last " << to_string(FlopDatabase::canonical_flop(flop))
+              << ", " << static_cast<int>(seconds * (total - done) / done) << "s left   " << std::flush;
+  };
+
+  try {
+    size_t computed = FlopDatabase::generate(path, options);
+    std::cerr << (computed ? "\n" : "") << "Computed " << computed << " flops, "
+              << FlopDatabase::load(path).size() << "/" << FlopDatabase::NUM_FLOPS << " present" << std::endl;
+  } catch (const std::exception& e) {
+    std::cerr << "\nError: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -7,20 +7,27 @@
 #include "utils.h"
 #include "evaluation.hpp"
 
+#include "app/async_evaluator.hpp"
+#include "app/next_card_preview.hpp"
+
 #include "app/card.hpp"
 #include "app/card_selector.hpp"
 #include "app/cards_display.hpp"
+#include "app/draw_card.hpp"
+#include "app/range_view.hpp"
 #include "app/reset_button.hpp"
 
 #include "app/debug_display.hpp"
 
 
 int main() {
-  auto evaluator = Evaluator();
+  // Evaluations run in the background; the loop only polls for results
+  AsyncEvaluator evaluator;
+  NextCardPreview preview;
 
   const sf::Vector2u initialWindowSize = {960u, 1080u};
 
-  sf::Font font("resources/DejaVuSans.ttf");
+  const sf::Font& font = appFont();
   auto debug_display = DebugDisplay(font, 14);
 
   auto window = sf::RenderWindow(sf::VideoMode(initialWindowSize), "Holdem Evaluator");
@@ -37,49 +44,124 @@ int main() {
 
   auto resetButton = ResetButton({handSelectorPosition.x + 13.f * 60.f + 20.f, handSelectorPosition.y}, {100.f, 50.f});
 
+  // Range-vs-range mode, toggled with M; the card selector then deals the board
+  auto rangeView = RangeView(font);
+  bool rangeMode = false;
+
   int nextInput = 0;
   std::optional<Card> selectedCard;
 
   // --- Evaluator state ---
-  std::vector<uint32_t> player_cards;
-  std::vector<uint32_t> board_cards;
+  Situation situation;
   int lastComputedInput = -1;
 
   float prob1 = 0.f, prob2 = 0.f, probTie = 0.f;
+  size_t simulationsDone = 0;
+  bool evaluating = false;
+
+  // Texts are kept between frames; SFML only rebuilds their glyphs when the
+  // string changes
+  sf::Text resultText(font);
+  resultText.setCharacterSize(24);
+  resultText.setFillColor(sf::Color::White);
+  resultText.setPosition({600.f, 50.f});
+
+  sf::Text previewText(font);
+  previewText.setCharacterSize(20);
+  previewText.setFillColor(sf::Color(220, 220, 160));
+  previewText.setPosition({600.f, 190.f});
+
+  auto formatResult = [](float win1, float win2, float tie) {
+    return
+      "Player 1 Win: " + std::to_string(static_cast<int>(win1 * 10000.f) / 100.f) + "%\n" +
+      "Player 2 Win: " + std::to_string(static_cast<int>(win2 * 10000.f) / 100.f) + "%\n" +
+      "Tie: " + std::to_string(static_cast<int>(tie * 10000.f) / 100.f) + "%";
+  };
+
+  auto resetAll = [&] {
+    // reset state
+    hand1.reset();
+    hand2.reset();
+    board.reset();
+    cardSelector.reset();
+    rangeView.reset();
+    nextInput = 0;
+    selectedCard.reset();
+
+    // reset computation state
+    evaluator.cancel();
+    preview.cancel();
+    prob1 = prob2 = probTie = 0.f;
+    simulationsDone = 0;
+    evaluating = false;
+    lastComputedInput = -1;
+  };
+
+  // The window is only redrawn when something changed
+  bool dirty = true;
+  bool waitingForResults = false;
+  bool previewReady = false;
 
   while (window.isOpen()) {
+    // Sleep until the next event. While results are still coming in, wake up
+    // at the frame rate to pick them up.
+    auto event = waitingForResults ? window.waitEvent(sf::milliseconds(16)) : window.waitEvent();
     const auto& mousePos = sf::Mouse::getPosition(window);
 
-    while (const std::optional event = window.pollEvent()) {
+    for (; event.has_value(); event = window.pollEvent()) {
+      dirty = true;
+
       if (event->is<sf::Event::Closed>()) {
         window.close();
       } else if (const auto* key = event->getIf<sf::Event::KeyPressed>()) {
         if (key->scancode == sf::Keyboard::Scancode::Q) {
           window.close();
+        } else if (key->scancode == sf::Keyboard::Scancode::M) {
+          resetAll();
+          rangeMode = !rangeMode;
+        }
+      } else if (const auto* click = event->getIf<sf::Event::MouseButtonPressed>();
+                 click && click->button == sf::Mouse::Button::Left) {
+        if (rangeMode && rangeView.handleClick(mousePos)) {
+          continue;
         }
-      } else if (sf::Mouse::isButtonPressed(sf::Mouse::Button::Left)) {
         // If the card selector was clicked, store that card
         selectedCard = cardSelector.getClickedCard(mousePos);
         if (!selectedCard.has_value()) {
           // If the reset button was clicked, reset everything
           if (resetButton.isClicked(mousePos)) {
-            // reset state
-            hand1.reset();
-            hand2.reset();
-            board.reset();
-            cardSelector.reset();
-            nextInput = 0;
-            selectedCard.reset();
-
-            // reset computation state
-            prob1 = prob2 = probTie = 0.f;
-            lastComputedInput = -1;
+            resetAll();
           }
         }
+      } else if (const auto* scroll = event->getIf<sf::Event::MouseWheelScrolled>()) {
+        if (rangeMode) {
+          rangeView.handleScroll(scroll->position, scroll->delta);
+        }
       }
     }
 
-    window.clear(sf::Color(100, 40, 40)); // Dark red background
+    if (rangeMode) {
+      if (selectedCard.has_value() && !rangeView.boardFull()) {
+        rangeView.addBoardCard(*selectedCard);
+        cardSelector.selectCard(*selectedCard);
+      }
+      selectedCard.reset();
+
+      if (rangeView.update()) {
+        dirty = true;
+      }
+      waitingForResults = rangeView.busy();
+
+      if (dirty) {
+        window.clear(sf::Color(100, 40, 40)); // Dark red background
+        cardSelector.draw(window);
+        rangeView.draw(window);
+        resetButton.draw(window);
+        window.display();
+        dirty = false;
+      }
+      continue;
+    }
 
     // Input handling
     if (selectedCard.has_value() && nextInput <= 8) {
@@ -109,38 +191,67 @@ int main() {
       }
 
       if (should_compute) {
-        player_cards.clear();
-        player_cards.push_back(to_engine_card(*hand1.getCard(0)));
-        player_cards.push_back(to_engine_card(*hand1.getCard(1)));
-        player_cards.push_back(to_engine_card(*hand2.getCard(0)));
-        player_cards.push_back(to_engine_card(*hand2.getCard(1)));
-
-        evaluator.set_hands(player_cards.begin(), player_cards.end());
-        evaluator.set_board(); // Clear board first
+        situation.hands.clear();
+        situation.hands.push_back({to_engine_card(*hand1.getCard(0)), to_engine_card(*hand1.getCard(1))});
+        situation.hands.push_back({to_engine_card(*hand2.getCard(0)), to_engine_card(*hand2.getCard(1))});
 
+        situation.board.clear();
         if (board_size >= 3) {
           // Flop is set
-          board_cards.clear();
-          std::transform(
-            board.getCards().begin(),
-            board.getCards().begin() + board_size,
-            std::back_inserter(board_cards),
-            [](const std::optional<Card>& c) { return to_engine_card(*c); }
-          );
-          evaluator.set_board(board_cards.begin(), board_cards.end());
+          for (int i = 0; i < board_size; ++i) {
+            situation.board.push_back(to_engine_card(*board.getCard(i)));
+          }
         }
 
-        auto results = evaluator.evaluate();
+        // Replaces (and cancels) the evaluation of the previous cards
+        evaluator.start(situation);
+        evaluating = true;
 
-        prob1 = results.win_prob;
-        probTie = results.tie_prob;
-        prob2 = 1.0f - prob1 - probTie;
+        // Equities for every possible next board card, shown on hover
+        if (board_size == 3 || board_size == 4) {
+          preview.start(situation);
+        } else {
+          preview.cancel();
+        }
 
         lastComputedInput = 4 + board_size;
       }
     }
 
+    // Pick up the latest estimate, refined batch by batch while simulating
+    if (auto progress = evaluator.poll()) {
+      prob1 = progress->result.win_prob;
+      probTie = progress->result.tie_prob;
+      prob2 = 1.0f - prob1 - probTie;
+      simulationsDone = progress->simulations;
+      evaluating = !progress->done;
+      dirty = true;
+    }
+
+    // What if the card under the mouse came next? getClickedCard skips the
+    // cards already dealt, and the preview is for the board last evaluated
+    std::optional<uint32_t> hoveredCard;
+    std::optional<EvalResult> hoveredResult;
+    if (lastComputedInput != -1 && (board.size() == 3 || board.size() == 4)) {
+      if (auto card = cardSelector.getClickedCard(mousePos)) {
+        hoveredCard = to_engine_card(*card);
+        hoveredResult = preview.get(*hoveredCard);
+      }
+    }
+    if (hoveredResult.has_value() != previewReady) {
+      previewReady = hoveredResult.has_value();
+      dirty = true;
+    }
+
+    waitingForResults = evaluating || (hoveredCard.has_value() && !hoveredResult.has_value());
+
+    if (!dirty) {
+      continue;
+    }
+
     // Draw UI
+    window.clear(sf::Color(100, 40, 40)); // Dark red background
+
     cardSelector.draw(window);
     hand1.draw(window);
     hand2.draw(window);
@@ -148,19 +259,22 @@ int main() {
     resetButton.draw(window);
 
     if (lastComputedInput != -1) {
-      sf::Text resultText(font);
-      resultText.setCharacterSize(24);
-      resultText.setFillColor(sf::Color::White);
-
       resultText.setString(
-        "Player 1 Win: " + std::to_string(static_cast<int>(prob1 * 10000.f) / 100.f) + "%\n" +
-        "Player 2 Win: " + std::to_string(static_cast<int>(prob2 * 10000.f) / 100.f) + "%\n" +
-        "Tie: " + std::to_string(static_cast<int>(probTie * 10000.f) / 100.f) + "%"
+        formatResult(prob1, prob2, probTie) +
+        (evaluating ? "\nSimulating... (" + std::to_string(simulationsDone) + ")" : "")
       );
-      resultText.setPosition({600.f, 50.f});
       window.draw(resultText);
     }
 
+    if (hoveredCard.has_value()) {
+      const auto& r = hoveredResult;
+      previewText.setString(
+        "If " + to_string(*hoveredCard) + " comes:\n" +
+        (r.has_value() ? formatResult(r->win_prob, 1.f - r->win_prob - r->tie_prob, r->tie_prob) : "...")
+      );
+      window.draw(previewText);
+    }
+
     // Draw debug info
     auto debug_s = "(" + std::to_string(mousePos.x) + ", " + std::to_string(mousePos.y) + ")";
 
@@ -168,5 +282,6 @@ int main() {
     debug_display.draw(window);
 
     window.display();
+    dirty = false;
   }
 }
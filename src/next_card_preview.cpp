@@ -0,0 +1,88 @@
+#include "app/next_card_preview.hpp"
+#include "card_set.h"
+
+#include <bit>
+
+NextCardPreview::NextCardPreview()
+  : worker_([this] { run(); }) {}
+
+NextCardPreview::~NextCardPreview() {
+  {
+    std::lock_guard lock(mutex_);
+    stop_ = true;
+    ++generation_;
+  }
+  wakeUp_.notify_one();
+  worker_.join();
+}
+
+void NextCardPreview::start(const Situation& situation) {
+  assert(situation.board.size() == 3 || situation.board.size() == 4);
+  {
+    std::lock_guard lock(mutex_);
+    ++generation_;
+    pending_ = situation;
+    results_.fill(std::nullopt);
+    requested_.reset();
+  }
+  wakeUp_.notify_one();
+}
+
+void NextCardPreview::cancel() {
+  std::lock_guard lock(mutex_);
+  ++generation_;
+  pending_.reset();
+  results_.fill(std::nullopt);
+  requested_.reset();
+}
+
+std::optional<EvalResult> NextCardPreview::get(uint32_t card) {
+  std::lock_guard lock(mutex_);
+  CardIndex index = card_index(card);
+  if (!results_[index]) {
+    requested_ = index;
+  }
+  return results_[index];
+}
+
+void NextCardPreview::run() {
+  EvalScratch scratch;
+
+  while (true) {
+    Situation situation;
+    uint64_t generation;
+    {
+      std::unique_lock lock(mutex_);
+      wakeUp_.wait(lock, [this] { return stop_ || pending_.has_value(); });
+      if (stop_) return;
+      situation = *pending_;
+      pending_.reset();
+      generation = generation_;
+    }
+
+    CardSet remaining = CardSet::full() - situation.dead - CardSet(situation.board.begin(), situation.board.end());
+    for (const auto& hand : situation.hands) {
+      remaining -= CardSet(hand.begin(), hand.end());
+    }
+
+    situation.board.push_back(0);
+    while (!remaining.empty() && generation_ == generation) {
+      // The card under the mouse first, then the rest of the deck in order
+      CardIndex next = static_cast<CardIndex>(std::countr_zero(remaining.bits()));
+      {
+        std::lock_guard lock(mutex_);
+        if (requested_ && ((remaining.bits() >> *requested_) & 1)) {
+          next = *requested_;
+        }
+      }
+      remaining.erase(card_at(next));
+
+      situation.board.back() = card_at(next);
+      EvalResult result = evaluator_.evaluate(situation, scratch);
+
+      std::lock_guard lock(mutex_);
+      if (generation_ != generation) break;
+      results_[next] = result;
+    }
+  }
+}
@@ -0,0 +1,136 @@
+// Generates include/preflop_table_data.h, the preflop equities against
+// random opponents read by `preflop_vs_random`.
+//
+//   preflop_table_gen FILE [--simulations N] [--threads N]
+//
+// Each starting hand class is sampled against 1 to MAX_TABLE_OPPONENTS
+// random hands with Monte Carlo simulations.
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "card_index.h"
+#include "evaluation.hpp"
+#include "preflop_tables.h"
+#include "utils.h"
+
+namespace {
+  constexpr size_t NUM_CLASSES = 169;
+
+  void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " FILE [--simulations N] [--threads N]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --simulations N       Simulations per hand and opponent count (default: 1000000)\n";
+    std::cout << "  --threads N           Worker threads (default: one per core)\n";
+  }
+
+  // Hole cards of a starting hand class, spades first
+  std::array<uint32_t, 2> class_hand(size_t hand_class) {
+    int row = static_cast<int>(hand_class / 13);
+    int col = static_cast<int>(hand_class % 13);
+    if (row == col) {
+      return {card_at(12 - row), card_at(13 + 12 - row)};
+    }
+    if (row < col) {
+      return {card_at(12 - row), card_at(12 - col)};
+    }
+    return {card_at(12 - col), card_at(13 + 12 - row)};
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::string path;
+  size_t num_simulations = 1000000;
+  size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg == "--simulations" && i + 1 < argc) {
+        num_simulations = std::stoul(argv[++i]);
+      } else if (arg == "--threads" && i + 1 < argc) {
+        num_threads = std::stoul(argv[++i]);
+      } else if (path.empty() && arg[0] != '-') {
+        path = arg;
+      } else {
+        path.clear();
+        break;
+      }
+    }
+  } catch (const std::exception&) {
+    path.clear();
+  }
+
+  if (path.empty() || num_simulations == 0 || num_threads == 0) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  constexpr size_t num_entries = NUM_CLASSES * MAX_TABLE_OPPONENTS;
+  std::vector<EvalResult> entries(num_entries);
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> done{0};
+  std::mutex output_mutex;
+
+  auto work = [&] {
+    Evaluator evaluator;
+    evaluator.set_preflop_tables(false);
+    evaluator.set_num_simulations(num_simulations);
+    for (size_t entry; (entry = next++) < num_entries;) {
+      Situation situation;
+      situation.hands.push_back(class_hand(entry / MAX_TABLE_OPPONENTS));
+      entries[entry] = evaluator.evaluate_vs_random(situation, entry % MAX_TABLE_OPPONENTS + 1);
+
+      std::lock_guard lock(output_mutex);
+      std::cerr << "\r" << ++done << "/" << num_entries << " entries" << std::flush;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_threads; ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::cerr << std::endl;
+
+  std::ofstream out(path);
+  out << "#ifndef PREFLOP_TABLE_DATA_H_\n";
+  out << "#define PREFLOP_TABLE_DATA_H_\n\n";
+  out << "// Generated by preflop_table_gen with " << num_simulations << " simulations per entry\n\n";
+  out << "#include \"types.h\"\n\n";
+  out << "#include <array>\n";
+  out << "#include <cstddef>\n\n";
+  out << "// Most random opponents covered by the preflop tables\n";
+  out << "constexpr size_t MAX_TABLE_OPPONENTS = " << MAX_TABLE_OPPONENTS << ";\n\n";
+  out << "// Win and tie probabilities by starting hand class, against 1 to\n";
+  out << "// MAX_TABLE_OPPONENTS random hands\n";
+  out << "static constexpr std::array<std::array<EvalResult, MAX_TABLE_OPPONENTS>, " << NUM_CLASSES
+      << "> PREFLOP_VS_RANDOM = {{\n";
+  out << std::fixed << std::setprecision(6);
+  for (size_t hand_class = 0; hand_class < NUM_CLASSES; ++hand_class) {
+    out << "  // " << to_string(class_hand(hand_class)) << "\n  {{";
+    for (size_t i = 0; i < MAX_TABLE_OPPONENTS; ++i) {
+      const EvalResult& result = entries[hand_class * MAX_TABLE_OPPONENTS + i];
+      out << (i == 0 ? "" : i % 3 == 0 ? ",\n    " : ", ") << "{" << result.win_prob << "f, " << result.tie_prob << "f}";
+    }
+    out << "}},\n";
+  }
+  out << "}};\n\n";
+  out << "#endif // PREFLOP_TABLE_DATA_H_\n";
+
+  if (!out) {
+    std::cerr << "Error: could not write " << path << std::endl;
+    return 1;
+  }
+  return 0;
+}
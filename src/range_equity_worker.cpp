@@ -0,0 +1,138 @@
+#include "app/range_equity_worker.hpp"
+#include "card_index.h"
+
+#include <utility>
+
+RangeEquityWorker::RangeEquityWorker()
+  : worker_([this] { run(); }) {}
+
+RangeEquityWorker::~RangeEquityWorker() {
+  {
+    std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  wakeUp_.notify_one();
+  worker_.join();
+}
+
+void RangeEquityWorker::setBoard(const std::vector<uint32_t>& board) {
+  {
+    std::lock_guard lock(mutex_);
+    board_ = board;
+    boardChanged_ = true;
+    busy_ = true;
+    published_.reset();
+  }
+  wakeUp_.notify_one();
+}
+
+void RangeEquityWorker::setVillainWeight(int cell, float weight) {
+  {
+    std::lock_guard lock(mutex_);
+    villainWeights_[cell] = weight;
+    busy_ = true;
+  }
+  wakeUp_.notify_one();
+}
+
+void RangeEquityWorker::reset() {
+  {
+    std::lock_guard lock(mutex_);
+    board_.clear();
+    boardChanged_ = true;
+    villainWeights_.fill(0.f);
+    busy_ = true;
+    published_.reset();
+  }
+  wakeUp_.notify_one();
+}
+
+std::optional<std::vector<ComboTotals>> RangeEquityWorker::poll() {
+  std::lock_guard lock(mutex_);
+  return std::exchange(published_, std::nullopt);
+}
+
+const HandRange& RangeEquityWorker::combos() {
+  static const HandRange all = [] {
+    HandRange range;
+    for (int i = 0; i < 52; ++i) {
+      for (int j = i + 1; j < 52; ++j) {
+        range.addHand(card_at(i), card_at(j));
+      }
+    }
+    return range;
+  }();
+  return all;
+}
+
+void RangeEquityWorker::run() {
+  // What the totals were computed for
+  std::vector<uint32_t> board;
+  std::array<float, RangeGrid::NUM_CELLS> weights{};
+  std::vector<ComboTotals> totals(combos().hands().size(), {0, 0, 0});
+
+  while (true) {
+    bool fromScratch = false;
+    std::optional<int> changedCell;
+    float weight = 0.f;
+    {
+      std::unique_lock lock(mutex_);
+      auto nextChange = [&] {
+        for (int cell = 0; cell < RangeGrid::NUM_CELLS; ++cell) {
+          if (villainWeights_[cell] != weights[cell]) return std::optional<int>(cell);
+        }
+        return std::optional<int>();
+      };
+
+      wakeUp_.wait(lock, [&] {
+        busy_ = boardChanged_ || (board.size() >= 3 && nextChange());
+        return stop_ || busy_;
+      });
+      if (stop_) return;
+
+      if (boardChanged_) {
+        board = board_;
+        weights = villainWeights_;
+        boardChanged_ = false;
+        fromScratch = true;
+      } else {
+        changedCell = nextChange();
+        weight = villainWeights_[*changedCell];
+      }
+    }
+
+    if (board.size() < 3) {
+      continue;
+    }
+    evaluator_.set_board(board.begin(), board.end());
+
+    if (fromScratch) {
+      HandRange villain;
+      for (int cell = 0; cell < RangeGrid::NUM_CELLS; ++cell) {
+        for (const auto& [card1, card2] : RangeGrid::cellCombos(cell)) {
+          if (weights[cell] > 0.f) villain.addHand(card1, card2, weights[cell]);
+        }
+      }
+      totals = evaluator_.totals(combos(), villain);
+    } else {
+      // Totals against the cell's combos at weight 1, scaled by the change
+      HandRange cellRange;
+      for (const auto& [card1, card2] : RangeGrid::cellCombos(*changedCell)) {
+        cellRange.addHand(card1, card2);
+      }
+      const auto& delta = evaluator_.totals(combos(), cellRange);
+      const double scale = static_cast<double>(weight) - weights[*changedCell];
+      for (size_t i = 0; i < totals.size(); ++i) {
+        totals[i].win += scale * delta[i].win;
+        totals[i].tie += scale * delta[i].tie;
+        totals[i].total += scale * delta[i].total;
+      }
+      weights[*changedCell] = weight;
+    }
+
+    std::lock_guard lock(mutex_);
+    if (!boardChanged_) {
+      published_ = totals;
+    }
+  }
+}
@@ -1,57 +1,245 @@
 #include "range_evaluation.hpp"
+#include "card_set.h"
+#include "split_eval.h"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
-#include <random>
 
-static std::random_device rd;
-static std::mt19937 g(rd());
-static BitsetRankIndex hash{MAX_HASH_KEY, KEYS};
+namespace {
+  /**
+   * Weight of the villain combos added so far, in total and by card.
+   */
+  struct CumulativeWeight {
+    double total{0};
+    std::array<double, 52> by_card{};
 
-RangeEvaluator::RangeEvaluator()
-  : m_deck{initialize_deck()} {
-  m_deck_nodup.reserve(52);
+    void add(CardIndex first, CardIndex second, float weight) {
+      total += weight;
+      by_card[first] += weight;
+      by_card[second] += weight;
+    }
+
+    // Weight of the combos sharing no card with {first, second}, except that
+    // the combo {first, second} itself has been subtracted twice
+    double without(CardIndex first, CardIndex second) const {
+      return total - by_card[first] - by_card[second];
+    }
+  };
+
+  size_t pair_id(CardIndex a, CardIndex b) {
+    return a < b ? a * 52 + b : b * 52 + a;
+  }
 }
 
+RangeEvaluator::RangeEvaluator(uint64_t seed)
+  : m_evaluator{seed} {}
+
 void RangeEvaluator::set_num_simulations(size_t n) {
-  num_simulations = n;
+  m_evaluator.set_num_simulations(n);
+  m_cache_valid = false;
 }
 
 EvalResult RangeEvaluator::evaluate(const std::pair<uint32_t, uint32_t>& hand, const HandRange& range) {
-  std::array<uint32_t, 4> hands = {hand.first, hand.second, 0, 0};
+  if (!m_cache_valid || hand != m_cached_hand) {
+    m_combo_results.assign(52 * 52, std::nullopt);
+    m_cached_hand = hand;
+    m_cache_valid = true;
+    m_range_epoch = 0;
+  }
+
+  const auto& changes = range.changes();
+  if (range.epoch() != m_range_epoch || m_changes_seen > changes.size()) {
+    rebuild_sums(range);
+    m_range_epoch = range.epoch();
+  } else {
+    for (size_t i = m_changes_seen; i < changes.size(); ++i) {
+      add_to_sums(changes[i].hand, static_cast<double>(changes[i].new_weight) - changes[i].old_weight);
+    }
+  }
+  m_changes_seen = changes.size();
+
+  // Below this, the remaining weight is rounding error from removed combos
+  if (m_weight_sum <= 1e-9) {
+    return {0.f, 0.f};
+  }
+  return {static_cast<float>(m_win_sum / m_weight_sum), static_cast<float>(m_tie_sum / m_weight_sum)};
+}
+
+void RangeEvaluator::rebuild_sums(const HandRange& range) {
+  m_weight_sum = m_win_sum = m_tie_sum = 0;
+
+  // From the flop on, the equities against all new combos come out of one
+  // sweep, run from the combos' side against the hand
+  if (m_situation.board.size() >= 3) {
+    CardSet blockers = m_situation.dead | CardSet(m_situation.board.begin(), m_situation.board.end());
+    blockers.insert(m_cached_hand.first);
+    blockers.insert(m_cached_hand.second);
+
+    m_missing.clear();
+    for (const auto& wh : range.hands()) {
+      const auto& [c1, c2] = wh.hand;
+      if (wh.weight == 0.f || blockers.contains(c1) || blockers.contains(c2)) continue;
+      if (!m_combo_results[pair_id(card_index(c1), card_index(c2))]) {
+        m_missing.push_back({wh.hand, 1.f});
+      }
+    }
+
+    if (!m_missing.empty()) {
+      m_cached_hand_range.clear();
+      m_cached_hand_range.addHand(m_cached_hand.first, m_cached_hand.second);
+      sweep(m_missing.data(), m_missing.size(), m_cached_hand_range);
+
+      for (size_t i = 0; i < m_missing.size(); ++i) {
+        const auto& [c1, c2] = m_missing[i].hand;
+        const ComboTotals& t = m_totals[i];
+        m_combo_results[pair_id(card_index(c1), card_index(c2))] = EvalResult{
+          static_cast<float>((t.total - t.win - t.tie) / t.total),
+          static_cast<float>(t.tie / t.total)
+        };
+      }
+    }
+  }
+
+  for (const auto& wh : range.hands()) {
+    add_to_sums(wh.hand, wh.weight);
+  }
+}
 
-  size_t total_hands = 0;
-  float total_win_prob = 0.f;
-  float total_tie_prob = 0.f;
+void RangeEvaluator::add_to_sums(const std::pair<uint32_t, uint32_t>& combo, double weight) {
+  // Combos sharing a card with the hand, the board or the dead cards cannot
+  // be dealt
+  CardSet blockers = m_situation.dead | CardSet(m_situation.board.begin(), m_situation.board.end());
+  blockers.insert(m_cached_hand.first);
+  blockers.insert(m_cached_hand.second);
 
-  for (size_t i = 0; i < range.hands().size(); ++i) {
-    const auto& wh = range.hands()[i];
-    std::pair<uint32_t, uint32_t> h = wh.hand;
-    float w = wh.weight;
+  if (weight == 0 || blockers.contains(combo.first) || blockers.contains(combo.second)) {
+    return;
+  }
 
-    if (w == 0.f) continue;
+  const EvalResult& result = combo_result(combo);
+  m_weight_sum += weight;
+  m_win_sum += weight * result.win_prob;
+  m_tie_sum += weight * result.tie_prob;
+}
 
-    hands[2] = h.first;
-    hands[3] = h.second;
+const EvalResult& RangeEvaluator::combo_result(const std::pair<uint32_t, uint32_t>& combo) {
+  auto& result = m_combo_results[pair_id(card_index(combo.first), card_index(combo.second))];
+  if (!result) {
+    m_situation.hands = {{m_cached_hand.first, m_cached_hand.second}, {combo.first, combo.second}};
+    result = m_evaluator.evaluate(m_situation, m_scratch);
+  }
+  return *result;
+}
 
-    m_evaluator.set_hands(hands.begin(), hands.end());
+const std::vector<ComboTotals>& RangeEvaluator::totals(const HandRange& hero, const HandRange& villain) {
+  sweep(hero.hands().data(), hero.hands().size(), villain);
+  return m_totals;
+}
 
-    auto result = m_evaluator.evaluate();
+std::vector<EvalResult> RangeEvaluator::evaluate(const HandRange& hero, const HandRange& villain) {
+  sweep(hero.hands().data(), hero.hands().size(), villain);
 
-    total_win_prob += result.win_prob * weight;
-    total_tie_prob += result.tie_prob * weight;
-    total_hands += weight;
+  std::vector<EvalResult> results(m_totals.size(), {0.f, 0.f});
+  for (size_t i = 0; i < m_totals.size(); ++i) {
+    const ComboTotals& t = m_totals[i];
+    if (t.total > 0) {
+      results[i] = {static_cast<float>(t.win / t.total), static_cast<float>(t.tie / t.total)};
+    }
   }
+  return results;
+}
+
+void RangeEvaluator::sweep(const WeightedHand* hero, size_t num_hero, const HandRange& villain) {
+  assert(m_situation.board.size() >= 3);
+
+  const SplitEvaluator& evaluator = split_evaluator();
+  m_totals.assign(num_hero, {0, 0, 0});
+  m_pair_weight.resize(52 * 52, 0.f);
 
-  if (total_hands > 0) {
-    total_win_prob /= total_hands;
-    total_tie_prob /= total_hands;
+  HandSummary board;
+  for (uint32_t card : m_situation.board) {
+    board.add(card);
   }
+  CardSet unavailable = m_situation.dead | CardSet(m_situation.board.begin(), m_situation.board.end());
+
+  auto sweep_runout = [&](const HandSummary& summary, CardSet dead) {
+    auto rank_combos = [&](const WeightedHand* hands, size_t n, bool skip_unweighted, std::vector<RankedCombo>& out) {
+      out.clear();
+      for (size_t i = 0; i < n; ++i) {
+        const auto& [cards, weight] = hands[i];
+        if (skip_unweighted && weight == 0.f) continue;
+        if (dead.contains(cards.first) || dead.contains(cards.second)) continue;
+
+        HandSummary hand = summary;
+        hand.add(cards.first);
+        hand.add(cards.second);
+        out.push_back({evaluator.eval(hand), card_index(cards.first), card_index(cards.second), weight, static_cast<uint32_t>(i)});
+      }
+      // Weakest first: higher ranks are worse
+      std::sort(out.begin(), out.end(), [](const RankedCombo& a, const RankedCombo& b) { return a.rank > b.rank; });
+    };
+
+    rank_combos(hero, num_hero, false, m_hero_combos);
+    rank_combos(villain.hands().data(), villain.hands().size(), true, m_villain_combos);
+
+    CumulativeWeight all;
+    for (const auto& v : m_villain_combos) {
+      all.add(v.first, v.second, v.weight);
+      m_pair_weight[pair_id(v.first, v.second)] += v.weight;
+    }
+
+    // Both lists go from weakest to strongest, so the villain combos weaker
+    // than, or no stronger than, the hero combo only ever grow
+    CumulativeWeight weaker;
+    CumulativeWeight not_stronger;
+    size_t num_weaker = 0;
+    size_t num_not_stronger = 0;
+
+    for (const auto& h : m_hero_combos) {
+      while (num_weaker < m_villain_combos.size() && m_villain_combos[num_weaker].rank > h.rank) {
+        const auto& v = m_villain_combos[num_weaker++];
+        weaker.add(v.first, v.second, v.weight);
+      }
+      while (num_not_stronger < m_villain_combos.size() && m_villain_combos[num_not_stronger].rank >= h.rank) {
+        const auto& v = m_villain_combos[num_not_stronger++];
+        not_stronger.add(v.first, v.second, v.weight);
+      }
+
+      // Removing the combos that hold either hero card subtracts the combo of
+      // both cards twice (inclusion-exclusion). It ranks like the hero, so it
+      // is in the sums no stronger than the hero, never in the weaker ones:
+      // its weight is added back once to the ties and the total
+      double same = m_pair_weight[pair_id(h.first, h.second)];
+      double win = weaker.without(h.first, h.second);
+
+      ComboTotals& t = m_totals[h.index];
+      t.win += win;
+      t.tie += not_stronger.without(h.first, h.second) + same - win;
+      t.total += all.without(h.first, h.second) + same;
+    }
+
+    for (const auto& v : m_villain_combos) {
+      m_pair_weight[pair_id(v.first, v.second)] = 0.f;
+    }
+  };
 
-  EvalResult result;
-  result.win_prob = total_win_prob;
-  result.tie_prob = total_tie_prob;
+  // Deal the missing cards in increasing order, so each runout comes once
+  auto deal = [&](auto& self, const HandSummary& summary, CardSet dead, int first_card, size_t num_cards) -> void {
+    if (num_cards == 5) {
+      sweep_runout(summary, dead);
+      return;
+    }
+    for (int index = first_card; index < 52; ++index) {
+      uint32_t card = card_at(index);
+      if (dead.contains(card)) continue;
 
-  return result;
+      HandSummary next = summary;
+      next.add(card);
+      CardSet next_dead = dead;
+      next_dead.insert(card);
+      self(self, next, next_dead, index + 1, num_cards + 1);
+    }
+  };
+  deal(deal, board, unavailable, 0, m_situation.board.size());
 }
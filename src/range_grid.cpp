@@ -0,0 +1,129 @@
+#include "app/range_grid.hpp"
+#include "app/draw_card.hpp"
+#include "utils.h"
+
+namespace {
+  constexpr char RANKS[] = "AKQJT98765432";
+  constexpr int SUITS[4] = {SPADES, HEARTS, DIAMONDS, CLUBS};
+
+  // Rank of a grid row or column, 2..14
+  int rankAt(int i) {
+    return 14 - i;
+  }
+
+  sf::Color lerp(sf::Color from, sf::Color to, float t) {
+    auto mix = [t](uint8_t a, uint8_t b) { return static_cast<uint8_t>(a + (b - a) * t); };
+    return {mix(from.r, to.r), mix(from.g, to.g), mix(from.b, to.b)};
+  }
+}
+
+RangeGrid::RangeGrid(const sf::Vector2f& position, float cellSize)
+  : position_(position), cellSize_(cellSize), cells_(sf::PrimitiveType::Triangles) {
+  for (int cell = 0; cell < NUM_CELLS; ++cell) {
+    sf::Text label(appFont());
+    label.setString(cellName(cell));
+    label.setCharacterSize(static_cast<unsigned int>(cellSize_ * 0.32f));
+    label.setFillColor(sf::Color::White);
+    label.setPosition(position_ + sf::Vector2f{(cell % 13) * cellSize_ + 2.f, (cell / 13) * cellSize_ + 2.f});
+    labels_.push_back(label);
+  }
+  updateCells();
+}
+
+void RangeGrid::draw(sf::RenderTarget& rt) const {
+  rt.draw(cells_);
+  for (const auto& label : labels_) {
+    rt.draw(label);
+  }
+}
+
+std::optional<int> RangeGrid::getClickedCell(const sf::Vector2i& mousePos) const {
+  sf::Vector2f relativePos = static_cast<sf::Vector2f>(mousePos) - position_;
+
+  if (relativePos.x < 0 || relativePos.y < 0 || relativePos.x >= cellSize_ * 13.f || relativePos.y >= cellSize_ * 13.f) {
+    return std::nullopt;
+  }
+
+  int col = static_cast<int>(relativePos.x / cellSize_);
+  int row = static_cast<int>(relativePos.y / cellSize_);
+  return row * 13 + col;
+}
+
+void RangeGrid::setWeight(int cell, float weight) {
+  weights_[cell] = weight;
+  updateCells();
+}
+
+void RangeGrid::setEquities(const std::array<std::optional<float>, NUM_CELLS>& equities) {
+  equities_ = equities;
+  updateCells();
+}
+
+void RangeGrid::clearEquities() {
+  equities_.fill(std::nullopt);
+  updateCells();
+}
+
+void RangeGrid::reset() {
+  weights_.fill(0.f);
+  equities_.fill(std::nullopt);
+  updateCells();
+}
+
+int RangeGrid::cellOf(uint32_t card1, uint32_t card2) {
+  int pos1 = 12 - static_cast<int>((card1 >> 8) & 0xf);
+  int pos2 = 12 - static_cast<int>((card2 >> 8) & 0xf);
+  int high = std::min(pos1, pos2);
+  int low = std::max(pos1, pos2);
+  bool suited = (card1 & card2 & 0xf000) != 0;
+
+  // Suited hands above the diagonal, offsuit hands (and pairs) below or on it
+  return suited ? high * 13 + low : low * 13 + high;
+}
+
+std::string RangeGrid::cellName(int cell) {
+  int row = cell / 13;
+  int col = cell % 13;
+  if (row == col) {
+    return {RANKS[row], RANKS[col]};
+  }
+  return {RANKS[std::min(row, col)], RANKS[std::max(row, col)], row < col ? 's' : 'o'};
+}
+
+std::vector<std::pair<uint32_t, uint32_t>> RangeGrid::cellCombos(int cell) {
+  int row = cell / 13;
+  int col = cell % 13;
+  int high = rankAt(std::min(row, col));
+  int low = rankAt(std::max(row, col));
+
+  std::vector<std::pair<uint32_t, uint32_t>> combos;
+  for (int s1 = 0; s1 < 4; ++s1) {
+    for (int s2 = 0; s2 < 4; ++s2) {
+      bool keep = row == col ? s1 < s2 : row < col ? s1 == s2 : s1 != s2;
+      if (keep) {
+        combos.emplace_back(card_from_rank_suit(high, SUITS[s1]), card_from_rank_suit(low, SUITS[s2]));
+      }
+    }
+  }
+  return combos;
+}
+
+void RangeGrid::updateCells() {
+  const sf::Color empty(50, 50, 50);
+  const sf::Color selected(200, 170, 40);
+
+  cells_.clear();
+  for (int cell = 0; cell < NUM_CELLS; ++cell) {
+    const float w = weights_[cell];
+
+    // Equity from red (0%) to green (100%); fainter for lower weights
+    sf::Color color = empty;
+    if (w > 0.f) {
+      sf::Color full = equities_[cell] ? lerp(sf::Color(200, 30, 30), sf::Color(30, 170, 30), *equities_[cell]) : selected;
+      color = lerp(empty, full, 0.3f + 0.7f * w);
+    }
+
+    const sf::Vector2f cellPosition = position_ + sf::Vector2f{(cell % 13) * cellSize_, (cell / 13) * cellSize_};
+    appendRect(cells_, cellPosition, {cellSize_ - 1.f, cellSize_ - 1.f}, color);
+  }
+}
@@ -0,0 +1,122 @@
+#include "app/range_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+RangeView::RangeView(const sf::Font& font)
+  : hero_({20.f, 10.f}, 30.f), villain_({500.f, 10.f}, 30.f),
+    board_({20.f, 410.f}, {50.f, 75.f}), text_(font) {
+  for (const auto& wh : RangeEquityWorker::combos().hands()) {
+    comboCells_.push_back(RangeGrid::cellOf(wh.hand.first, wh.hand.second));
+  }
+
+  text_.setCharacterSize(22);
+  text_.setFillColor(sf::Color::White);
+  text_.setPosition({320.f, 415.f});
+  updateEquities();
+}
+
+bool RangeView::handleClick(const sf::Vector2i& mousePos) {
+  for (RangeGrid* grid : {&hero_, &villain_}) {
+    if (auto cell = grid->getClickedCell(mousePos)) {
+      setWeight(*grid, *cell, grid->weight(*cell) > 0.f ? 0.f : 1.f);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RangeView::handleScroll(const sf::Vector2i& mousePos, float delta) {
+  for (RangeGrid* grid : {&hero_, &villain_}) {
+    if (auto cell = grid->getClickedCell(mousePos)) {
+      float weight = std::clamp(grid->weight(*cell) + (delta > 0.f ? 0.25f : -0.25f), 0.f, 1.f);
+      setWeight(*grid, *cell, weight);
+      return true;
+    }
+  }
+  return false;
+}
+
+void RangeView::addBoardCard(const Card& card) {
+  board_.setCard(static_cast<int>(board_.size()), card);
+
+  std::vector<uint32_t> cards;
+  for (size_t i = 0; i < board_.size(); ++i) {
+    cards.push_back(to_engine_card(*board_.getCard(i)));
+  }
+  worker_.setBoard(cards);
+
+  // Totals of the previous board no longer apply
+  totals_.clear();
+  updateEquities();
+}
+
+bool RangeView::update() {
+  auto totals = worker_.poll();
+  if (!totals.has_value()) {
+    return false;
+  }
+  totals_ = std::move(*totals);
+  updateEquities();
+  return true;
+}
+
+void RangeView::draw(sf::RenderTarget& rt) const {
+  hero_.draw(rt);
+  villain_.draw(rt);
+  board_.draw(rt);
+  rt.draw(text_);
+}
+
+void RangeView::reset() {
+  hero_.reset();
+  villain_.reset();
+  board_.reset();
+  worker_.reset();
+  totals_.clear();
+  updateEquities();
+}
+
+void RangeView::setWeight(RangeGrid& grid, int cell, float weight) {
+  grid.setWeight(cell, weight);
+  if (&grid == &villain_) {
+    worker_.setVillainWeight(cell, weight);
+  } else {
+    // Totals cover every hero combo already: only the weighting changes
+    updateEquities();
+  }
+}
+
+void RangeView::updateEquities() {
+  if (totals_.empty()) {
+    hero_.clearEquities();
+    text_.setString(board_.size() < 3 ? "Deal a flop to evaluate the ranges" : "Evaluating...");
+    return;
+  }
+
+  // Equity of a cell counts ties as half a win, over the combos the board
+  // does not block
+  std::array<double, RangeGrid::NUM_CELLS> won{}, faced{};
+  for (size_t i = 0; i < totals_.size(); ++i) {
+    won[comboCells_[i]] += totals_[i].win + totals_[i].tie / 2.;
+    faced[comboCells_[i]] += totals_[i].total;
+  }
+
+  std::array<std::optional<float>, RangeGrid::NUM_CELLS> equities;
+  double rangeWon = 0., rangeFaced = 0.;
+  for (int cell = 0; cell < RangeGrid::NUM_CELLS; ++cell) {
+    if (faced[cell] > 1e-9) {
+      equities[cell] = static_cast<float>(won[cell] / faced[cell]);
+    }
+    rangeWon += hero_.weight(cell) * won[cell];
+    rangeFaced += hero_.weight(cell) * faced[cell];
+  }
+  hero_.setEquities(equities);
+
+  if (rangeFaced > 1e-9) {
+    text_.setString("Hero equity: " + std::to_string(static_cast<int>(rangeWon / rangeFaced * 10000.) / 100.f) + "%");
+  } else {
+    text_.setString("Select a range for each player");
+  }
+}
@@ -0,0 +1,99 @@
+#include "rank_table.hpp"
+#include "bitset_rankindex.h"
+#include "eval.h"
+#include "split_eval.h"
+#include "thread_pool.hpp"
+#include "types.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  constexpr char MAGIC[8] = {'P', 'E', 'R', 'A', 'N', 'K', 'S', '1'};
+  constexpr size_t HEADER_BYTES = 4096;
+
+  // Hands ranked by one task, and between two writes
+  constexpr uint64_t BLOCK_HANDS = uint64_t(1) << 16;
+  constexpr uint64_t CHUNK_HANDS = uint64_t(1) << 23;
+
+  struct FileHeader {
+    char magic[8];
+    uint32_t num_cards;
+    uint32_t rank_bytes;
+    uint64_t num_hands;
+  };
+  static_assert(sizeof(FileHeader) <= HEADER_BYTES);
+}
+
+void RankTable::generate(const std::string& path, const GenerateOptions& options) {
+  if (options.num_cards < 7 || options.num_cards > 52 || options.num_threads == 0) {
+    throw std::invalid_argument("Invalid rank table options");
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.num_cards = static_cast<uint32_t>(options.num_cards);
+  header.rank_bytes = sizeof(uint16_t);
+  header.num_hands = binomial(static_cast<unsigned>(options.num_cards), 7);
+
+  FileWriter file(path, "rank table", true);
+
+  const auto& split = split_evaluator();
+  const BitsetRankIndex hash(MAX_HASH_KEY, KEYS);
+  ThreadPool pool(options.num_threads);
+
+  std::vector<uint16_t> chunk;
+  for (uint64_t first = 0; first < header.num_hands; first += CHUNK_HANDS) {
+    const uint64_t count = std::min(CHUNK_HANDS, header.num_hands - first);
+    chunk.resize(count);
+
+    // Hands in colex order share their largest cards, so each block folds
+    // them in once and only redeals the smallest
+    pool.parallel_for((count + BLOCK_HANDS - 1) / BLOCK_HANDS, 1, [&](size_t begin, size_t end) {
+      const uint64_t block_end = std::min(end * BLOCK_HANDS, count);
+      fold_combinations<7>(
+        first + begin * BLOCK_HANDS, first + block_end, HandSummary{},
+        [](HandSummary summary, uint8_t card) {
+          summary.add(card_at(card));
+          return summary;
+        },
+        [&, r = first + begin * BLOCK_HANDS](const std::array<uint8_t, 7>& hand, const HandSummary& summary) mutable {
+          uint16_t rank = split.eval(summary);
+          if (rank != ::eval7(hash, hand)) {
+            throw std::runtime_error("Rank table disagrees with eval7");
+          }
+          chunk[r++ - first] = rank;
+        });
+    });
+
+    file.write_at(chunk.data(), count * sizeof(uint16_t), HEADER_BYTES + first * sizeof(uint16_t));
+    if (options.progress) {
+      options.progress(first + count, header.num_hands);
+    }
+  }
+
+  // Until the magic is written, the file does not load
+  file.write_at(&header, sizeof(header), 0);
+  file.sync();
+}
+
+RankTable RankTable::load(const std::string& path) {
+  RankTable table;
+  table.m_file = MappedFile(path, "rank table");
+  const size_t size = table.m_file.size();
+  const auto* header = table.m_file.as<FileHeader>();
+  if (size < HEADER_BYTES || std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header->rank_bytes != sizeof(uint16_t) || header->num_cards < 7 || header->num_cards > 52 ||
+      header->num_hands != binomial(header->num_cards, 7) || HEADER_BYTES + header->num_hands * sizeof(uint16_t) != size) {
+    throw std::runtime_error("Invalid rank table: " + path);
+  }
+  // Each lookup reads two bytes at a random place: read ahead nothing
+  table.m_file.advise_random();
+
+  table.m_num_cards = header->num_cards;
+  table.m_size = header->num_hands;
+  table.m_ranks = table.m_file.as<uint16_t>(HEADER_BYTES);
+  return table;
+}
@@ -0,0 +1,70 @@
+// Generates the 7-card rank table read by `RankTable`.
+//
+//   rank_table_gen FILE [--threads N] [--cards N]
+//
+// Every hand is ranked and checked against `eval7` before it is written, so
+// a complete run also validates the table.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "rank_table.hpp"
+
+namespace {
+  void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " FILE [--threads N] [--cards N]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --threads N           Worker threads (default: one per core)\n";
+    std::cout << "  --cards N             Only rank the hands of the first N cards (default: 52)\n";
+  }
+}
+
+int main(int argc, char* argv[]) {
+  std::string path;
+  RankTable::GenerateOptions options;
+  options.num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (arg == "--threads" && i + 1 < argc) {
+        options.num_threads = std::stoul(argv[++i]);
+      } else if (arg == "--cards" && i + 1 < argc) {
+        options.num_cards = std::stoul(argv[++i]);
+      } else if (path.empty() && arg[0] != '-') {
+        path = arg;
+      } else {
+        path.clear();
+        break;
+      }
+    }
+  } catch (const std::exception&) {
+    path.clear();
+  }
+
+  if (path.empty()) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  options.progress = [&](uint64_t done, uint64_t total) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "\r" << done << "/" << total << " hands, " << static_cast<int>(seconds * (total - done) / done)
+              << "s left   " << std::flush;
+  };
+
+  try {
+    RankTable::generate(path, options);
+    auto table = RankTable::load(path);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "\nWrote " << table.size() << " hands in " << static_cast<int>(seconds) << "s" << std::endl;
+  } catch (const std::exception& e) {
+    std::cerr << "\nError: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
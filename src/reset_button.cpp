@@ -1,29 +1,27 @@
 #include "app/reset_button.hpp"
+#include "app/draw_card.hpp"
 
 ResetButton::ResetButton(const sf::Vector2f& position, const sf::Vector2f& size)
-  : position_(position), size_(size) {}
+  : position_(position), size_(size), button_(size), text_(appFont()) {
+  button_.setPosition(position_);
+  button_.setFillColor(sf::Color(200, 0, 0)); // Red button
 
-void ResetButton::draw(sf::RenderTarget& rt) const {
-  sf::RectangleShape button(size_);
-  button.setPosition(position_);
-  button.setFillColor(sf::Color(200, 0, 0)); // Red button
-  rt.draw(button);
-
-  sf::Font font("resources/DejaVuSans.ttf");
-  sf::Text buttonText(font);
-  buttonText.setString("Clear");
-  buttonText.setCharacterSize(static_cast<unsigned int>(size_.y * 0.6f));
-  buttonText.setFillColor(sf::Color::White);
+  text_.setString("Clear");
+  text_.setCharacterSize(static_cast<unsigned int>(size_.y * 0.6f));
+  text_.setFillColor(sf::Color::White);
 
-  const float textWidth = buttonText.getLocalBounds().size.x;
-  const float textHeight = buttonText.getLocalBounds().size.y;
+  const float textWidth = text_.getLocalBounds().size.x;
+  const float textHeight = text_.getLocalBounds().size.y;
 
-  buttonText.setPosition({
+  text_.setPosition({
       position_.x + (size_.x - textWidth) / 2.f,
       position_.y + (size_.y - textHeight) / 2.f - 5.f
     });
+}
 
-  rt.draw(buttonText);
+void ResetButton::draw(sf::RenderTarget& rt) const {
+  rt.draw(button_);
+  rt.draw(text_);
 }
 
 bool ResetButton::isClicked(const sf::Vector2i& mousePos) const {
@@ -0,0 +1,77 @@
+#include "split_eval.h"
+#include "card_index.h"
+#include "eval.h"
+#include "types.h"
+
+namespace {
+  constexpr uint32_t MAX_RANK_KEY = 4 * RANK_KEYS[12] + 3 * RANK_KEYS[11];
+
+  /**
+   * Call f(rank_key, counts) for every multiset of 7 ranks with at most 4
+   * cards of each rank.
+   */
+  template <typename F>
+  void for_each_rank_multiset(F&& f, std::array<int, 13>& counts, int rank = 0, int left = 7, uint32_t key = 0) {
+    if (rank == 13) {
+      if (left == 0) {
+        f(key, counts);
+      }
+      return;
+    }
+    for (int n = 0; n <= 4 && n <= left; ++n) {
+      counts[rank] = n;
+      for_each_rank_multiset(f, counts, rank + 1, left - n, key + n * RANK_KEYS[rank]);
+    }
+    counts[rank] = 0;
+  }
+
+  std::vector<uint32_t> rank_keys() {
+    std::vector<uint32_t> keys;
+    std::array<int, 13> counts{};
+    for_each_rank_multiset([&](uint32_t key, const auto&) { keys.push_back(key); }, counts);
+    return keys;
+  }
+}
+
+SplitEvaluator::SplitEvaluator()
+  : m_rank_index{MAX_RANK_KEY, rank_keys()} {
+  // The hands ranked here are not the caller's
+  STATS_PAUSE();
+
+  // Flushes: a suit holds at most 7 of the cards
+  m_flush.fill(0);
+  for (uint32_t mask = 0; mask < m_flush.size(); ++mask) {
+    int bits = std::popcount(mask);
+    if (bits < 5 || bits > 7) continue;
+
+    uint16_t best = 7462;
+    for (uint32_t sub = mask; sub; sub = (sub - 1) & mask) {
+      if (std::popcount(sub) == 5 && flush_table[sub] < best) {
+        best = flush_table[sub];
+      }
+    }
+    m_flush[mask] = best;
+  }
+
+  // Other hands: deal the ranks over the suits in turn so no suit gets 5
+  // cards, and rank the resulting hand
+  BitsetRankIndex hash{MAX_HASH_KEY, KEYS};
+  m_values.assign(m_rank_index.size(), 0);
+
+  std::array<int, 13> counts{};
+  for_each_rank_multiset([&](uint32_t key, const std::array<int, 13>& c) {
+    std::array<uint32_t, 7> hand{};
+    size_t n = 0;
+    for (int rank = 0; rank < 13; ++rank) {
+      for (int i = 0; i < c[rank]; ++i, ++n) {
+        hand[n] = CARD_FROM_INDEX[(n % 4) * 13 + rank];
+      }
+    }
+    m_values[m_rank_index(key)] = ::eval7(hash, hand);
+  }, counts);
+}
+
+const SplitEvaluator& split_evaluator() {
+  static const SplitEvaluator evaluator;
+  return evaluator;
+}
@@ -0,0 +1,186 @@
+#include "state_table.hpp"
+#include "bitset_rankindex.h"
+#include "eval.h"
+#include "types.h"
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+  constexpr char MAGIC[8] = {'P', 'E', 'S', 'T', 'A', 'T', 'E', '1'};
+
+  struct FileHeader {
+    char magic[8];
+    uint64_t size;
+  };
+
+  constexpr uint64_t TRACKED = uint64_t(1) << 13;
+
+  /**
+   * Cards seen so far. `ranks` holds 3 bits per rank counting the cards of
+   * that rank. `suits` holds 14 bits per suit: bit 13 is set while the suit
+   * can still make a flush, and bits 0..12 are then the ranks held in it.
+   */
+  struct StateKey {
+    uint64_t ranks;
+    uint64_t suits;
+
+    bool operator==(const StateKey&) const = default;
+  };
+
+  struct StateKeyHash {
+    size_t operator()(const StateKey& key) const {
+      return (key.ranks * 0x9E3779B97F4A7C15ull) ^ (key.suits * 0xC2B2AE3D27D4EB4Full);
+    }
+  };
+
+  /**
+   * Add card `index` to the `num_cards` cards of `key`. Return false when the
+   * card cannot be part of the hand.
+   */
+  bool add_card(StateKey& key, int num_cards, int index) {
+    int rank = index % 13;
+    int suit = index / 13;
+
+    if (((key.ranks >> (3 * rank)) & 7) == 4) {
+      return false;
+    }
+    key.ranks += uint64_t(1) << (3 * rank);
+
+    uint64_t field = (key.suits >> (14 * suit)) & 0x3fff;
+    if (field & TRACKED) {
+      if (field & (uint64_t(1) << rank)) {
+        return false;
+      }
+      key.suits |= uint64_t(1) << (14 * suit + rank);
+    }
+
+    // Stop tracking the suits that can no longer make a flush
+    int cards_left = 7 - (num_cards + 1);
+    for (int s = 0; s < 4; ++s) {
+      uint64_t f = (key.suits >> (14 * s)) & 0x3fff;
+      if ((f & TRACKED) && std::popcount(f & 0x1fff) + cards_left < 5) {
+        key.suits &= ~(uint64_t(0x3fff) << (14 * s));
+      }
+    }
+    return true;
+  }
+
+  class FinalRanks {
+  public:
+    FinalRanks() : m_hash{MAX_HASH_KEY, KEYS} {}
+
+    uint16_t operator()(const StateKey& key) {
+      for (int s = 0; s < 4; ++s) {
+        uint64_t f = (key.suits >> (14 * s)) & 0x3fff;
+        if ((f & TRACKED) && std::popcount(f & 0x1fff) >= 5) {
+          return flush(static_cast<uint16_t>(f & 0x1fff));
+        }
+      }
+
+      auto it = m_no_flush.find(key.ranks);
+      if (it != m_no_flush.end()) {
+        return it->second;
+      }
+
+      // Deal the ranks out over the suits in turn, so no suit gets 5 cards
+      std::array<uint32_t, 7> hand{};
+      size_t n = 0;
+      for (int rank = 0; rank < 13; ++rank) {
+        for (uint64_t c = (key.ranks >> (3 * rank)) & 7; c > 0; --c, ++n) {
+          hand[n] = CARD_FROM_INDEX[(n % 4) * 13 + rank];
+        }
+      }
+      uint16_t value = ::eval7(m_hash, hand);
+      m_no_flush.emplace(key.ranks, value);
+      return value;
+    }
+
+  private:
+    BitsetRankIndex m_hash;
+    std::unordered_map<uint64_t, uint16_t> m_no_flush;
+
+    // Best flush among the 5-card subsets of the ranks in `mask`
+    static uint16_t flush(uint16_t mask) {
+      uint16_t best = 7462;
+      for (uint16_t sub = mask; sub; sub = (sub - 1) & mask) {
+        if (std::popcount(sub) == 5 && flush_table[sub] < best) {
+          best = flush_table[sub];
+        }
+      }
+      return best;
+    }
+  };
+}
+
+StateTable StateTable::build() {
+  // The hands ranked here are not the caller's
+  STATS_PAUSE();
+  std::vector<uint32_t> entries;
+
+  FinalRanks final_ranks;
+  std::vector<StateKey> level = {{0, TRACKED | (TRACKED << 14) | (TRACKED << 28) | (TRACKED << 42)}};
+  uint32_t num_states = 1;
+
+  for (int num_cards = 0; num_cards < 7; ++num_cards) {
+    std::vector<StateKey> next_level;
+    std::unordered_map<StateKey, uint32_t, StateKeyHash> next_ids;
+
+    for (const auto& key : level) {
+      for (int card = 0; card < 52; ++card) {
+        StateKey next = key;
+        if (!add_card(next, num_cards, card)) {
+          entries.push_back(0);
+        } else if (num_cards == 6) {
+          entries.push_back(final_ranks(next));
+        } else {
+          auto [it, inserted] = next_ids.try_emplace(next, num_states);
+          if (inserted) {
+            next_level.push_back(next);
+            ++num_states;
+          }
+          entries.push_back(it->second * 52);
+        }
+      }
+    }
+
+    level = std::move(next_level);
+  }
+
+  // The size is only known now: move the entries to their final storage
+  StateTable table;
+  table.m_storage = TableBuffer(entries.size() * sizeof(uint32_t));
+  std::memcpy(table.m_storage.as<uint32_t>(), entries.data(), entries.size() * sizeof(uint32_t));
+  table.m_table = table.m_storage.as<uint32_t>();
+  table.m_size = entries.size();
+  return table;
+}
+
+StateTable StateTable::load(const std::string& path) {
+  StateTable table;
+  table.m_file = MappedFile(path, "state table");
+  const auto* header = table.m_file.as<FileHeader>();
+  if (table.m_file.size() < sizeof(FileHeader) || std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      sizeof(FileHeader) + header->size * sizeof(uint32_t) != table.m_file.size()) {
+    throw std::runtime_error("Invalid state table: " + path);
+  }
+
+  table.m_table = table.m_file.as<uint32_t>(sizeof(FileHeader));
+  table.m_size = header->size;
+  return table;
+}
+
+void StateTable::save(const std::string& path) const {
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.size = m_size;
+
+  FileWriter file(path, "state table", true);
+  file.write_at(m_table, m_size * sizeof(uint32_t), sizeof(FileHeader));
+  // Until the magic is written, the file does not load
+  file.write_at(&header, sizeof(header), 0);
+  file.sync();
+}
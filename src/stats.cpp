@@ -0,0 +1,66 @@
+#include "stats.h"
+
+#ifdef HOLDEM_STATS
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace {
+  // Counters of the running threads, and the totals of the finished ones
+  std::mutex registry_mutex;
+  std::vector<stats::ThreadCounters*> registry;
+  std::array<uint64_t, stats::NUM_COUNTERS> retired{};
+}
+
+stats::ThreadCounters::ThreadCounters() {
+  std::lock_guard lock(registry_mutex);
+  registry.push_back(this);
+}
+
+stats::ThreadCounters::~ThreadCounters() {
+  std::lock_guard lock(registry_mutex);
+  for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+    retired[i] += values[i].load(std::memory_order_relaxed);
+  }
+  registry.erase(std::find(registry.begin(), registry.end(), this));
+}
+
+EvalStats eval_stats() {
+  std::array<uint64_t, stats::NUM_COUNTERS> sums;
+  {
+    std::lock_guard lock(registry_mutex);
+    sums = retired;
+    for (const auto* counters : registry) {
+      for (size_t i = 0; i < stats::NUM_COUNTERS; ++i) {
+        sums[i] += counters->values[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  return {
+    sums[stats::EVAL5], sums[stats::FLUSH], sums[stats::UNIQUE5], sums[stats::HASH],
+    sums[stats::EVAL7], sums[stats::SIMULATIONS], sums[stats::DECK_REBUILDS],
+    sums[stats::SETUP_NS] * 1e-9, sums[stats::SIMULATE_NS] * 1e-9, sums[stats::REDUCE_NS] * 1e-9
+  };
+}
+
+void reset_eval_stats() {
+  std::lock_guard lock(registry_mutex);
+  retired.fill(0);
+  for (auto* counters : registry) {
+    for (auto& value : counters->values) {
+      value.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+#else
+
+EvalStats eval_stats() {
+  return {};
+}
+
+void reset_eval_stats() {}
+
+#endif // HOLDEM_STATS
@@ -0,0 +1,239 @@
+// Compares the memory layout of the lookup tables against the previous one,
+// reading cache and TLB misses from the hardware counters.
+//
+//   table_bench [lookups]
+//
+// Run with HOLDEM_HUGETLB=1 to back the large tables with explicit huge pages
+// (see table_buffer.h). Counters the kernel or the machine does not provide,
+// e.g. inside most containers and VMs, are shown as "n/a".
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "bitset_rankindex.h"
+#include "card_index.h"
+#include "eval.h"
+#include "rng.h"
+#include "types.h"
+
+namespace {
+  struct CounterSpec {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+  };
+
+  constexpr uint64_t cache_event(uint64_t cache, uint64_t result) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+  }
+
+  const std::array<CounterSpec, 5> COUNTERS = {{
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"L1D misses", PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"LLC misses", PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"dTLB misses", PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"dTLB loads", PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+  }};
+
+  /**
+   * Hardware counters of the calling thread, user space only.
+   */
+  class Counters {
+  public:
+    Counters() {
+      for (size_t i = 0; i < COUNTERS.size(); ++i) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = COUNTERS[i].type;
+        attr.config = COUNTERS[i].config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fds[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+      }
+    }
+
+    ~Counters() {
+      for (int fd : m_fds) {
+        if (fd >= 0) ::close(fd);
+      }
+    }
+
+    Counters(const Counters&) = delete;
+    Counters& operator=(const Counters&) = delete;
+
+    template <typename F>
+    std::array<int64_t, COUNTERS.size()> measure(F&& f) {
+      for (int fd : m_fds) {
+        if (fd >= 0) {
+          ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+          ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+      }
+      f();
+      std::array<int64_t, COUNTERS.size()> values;
+      for (size_t i = 0; i < m_fds.size(); ++i) {
+        values[i] = -1;
+        uint64_t value;
+        if (m_fds[i] >= 0) {
+          ::ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+          if (::read(m_fds[i], &value, sizeof(value)) == sizeof(value)) {
+            values[i] = static_cast<int64_t>(value);
+          }
+        }
+      }
+      return values;
+    }
+
+  private:
+    std::array<int, COUNTERS.size()> m_fds;
+  };
+
+  /**
+   * The previous rank index: the bitset and the running counts in two
+   * separate heap arrays, so a lookup touches two cache lines and two pages.
+   */
+  class TwoArrayRankIndex {
+  public:
+    TwoArrayRankIndex(uint32_t max_value, const std::vector<uint32_t>& keys) {
+      size_t words = (static_cast<size_t>(max_value) + 64) / 64;
+      m_bits.assign(words, 0);
+      for (uint32_t k : keys) {
+        m_bits[k >> 6] |= uint64_t(1) << (k & 63);
+      }
+      m_prefix.resize(words);
+      uint32_t running = 0;
+      for (size_t i = 0; i < words; ++i) {
+        m_prefix[i] = running;
+        running += std::popcount(m_bits[i]);
+      }
+    }
+
+    uint32_t operator()(uint32_t k) const {
+      size_t w = k >> 6;
+      uint64_t mask = (uint64_t(1) << (k & 63)) - 1;
+      return m_prefix[w] + std::popcount(m_bits[w] & mask);
+    }
+
+  private:
+    std::vector<uint64_t> m_bits;
+    std::vector<uint32_t> m_prefix;
+  };
+
+  // The previous eval5 front end: one lookup in each of the separate arrays
+  uint16_t eval5_two_arrays(const std::array<uint32_t, 5>& hand) {
+    int idx = q(hand);
+    if (is_flush(hand)) {
+      return flush_table[idx];
+    }
+    return unique5[idx];
+  }
+
+  uint16_t eval5_interleaved(const std::array<uint32_t, 5>& hand) {
+    const Eval5Entry& entry = eval5_table[q(hand)];
+    return is_flush(hand) ? entry.flush : entry.unique;
+  }
+
+  /**
+   * Run f a few times and print the counters of the fastest run.
+   */
+  template <typename F>
+  void report(Counters& counters, const std::string& name, size_t lookups, F&& f) {
+    uint64_t checksum = 0;
+    double best = 0;
+    std::array<int64_t, COUNTERS.size()> values{};
+    for (int run = 0; run < 3; ++run) {
+      auto start = std::chrono::steady_clock::now();
+      auto run_values = counters.measure([&] { checksum = f(); });
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      if (run == 0 || seconds < best) {
+        best = seconds;
+        values = run_values;
+      }
+    }
+
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << best * 1e9 / lookups;
+    for (int64_t value : values) {
+      if (value < 0) {
+        std::cout << std::setw(12) << "n/a";
+      } else {
+        std::cout << std::setw(12) << static_cast<double>(value) * 1000 / lookups;
+      }
+    }
+    std::cout << "    (checksum " << checksum << ")\n";
+  }
+}
+
+int main(int argc, char* argv[]) {
+  size_t lookups = argc > 1 ? std::stoull(argv[1]) : 20'000'000;
+
+  // Random 5-card hands, and the prime products of those needing the hash
+  Philox4x32 rng(42);
+  std::vector<std::array<uint32_t, 5>> hands(1 << 20);
+  std::vector<uint32_t> products;
+  for (auto& hand : hands) {
+    uint64_t used = 0;
+    for (auto& card : hand) {
+      int index;
+      do {
+        index = rng.bounded(52);
+      } while ((used >> index) & 1);
+      used |= uint64_t(1) << index;
+      card = card_at(index);
+    }
+    if (!is_flush(hand) && !unique5[q(hand)]) {
+      products.push_back((hand[0] & 0xff) * (hand[1] & 0xff) * (hand[2] & 0xff) * (hand[3] & 0xff) * (hand[4] & 0xff));
+    }
+  }
+
+  // A power of two, so picking the next key costs no division
+  products.resize(std::bit_floor(products.size()));
+
+  TwoArrayRankIndex two_arrays(MAX_HASH_KEY, KEYS);
+  BitsetRankIndex blocks(MAX_HASH_KEY, KEYS);
+
+  Counters counters;
+  std::cout << "Counters per 1000 lookups\n\n" << std::string(34, ' ') << std::setw(12) << "ns/lookup";
+  for (const auto& counter : COUNTERS) {
+    std::cout << std::setw(12) << counter.name;
+  }
+  std::cout << "\n";
+
+  auto run_hands = [&](auto&& eval) {
+    return [&, eval] {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < lookups; ++i) {
+        sum += eval(hands[i & (hands.size() - 1)]);
+      }
+      return sum;
+    };
+  };
+  auto run_index = [&](const auto& index) {
+    return [&] {
+      uint64_t sum = 0;
+      for (size_t i = 0; i < lookups; ++i) {
+        sum += index(products[i & (products.size() - 1)]);
+      }
+      return sum;
+    };
+  };
+
+  report(counters, "eval5 flush/unique5, two arrays", lookups, run_hands(eval5_two_arrays));
+  report(counters, "eval5 flush/unique5, interleaved", lookups, run_hands(eval5_interleaved));
+  report(counters, "rank index, two arrays", lookups, run_index(two_arrays));
+  report(counters, "rank index, interleaved", lookups, run_index(blocks));
+  return 0;
+}
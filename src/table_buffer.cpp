@@ -0,0 +1,221 @@
+#include "table_buffer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  bool hugetlb_requested() {
+    const char* value = std::getenv("HOLDEM_HUGETLB");
+    return value && *value && std::strcmp(value, "0") != 0;
+  }
+
+  size_t round_up(size_t bytes, size_t to) {
+    return (bytes + to - 1) / to * to;
+  }
+}
+
+TableBuffer::TableBuffer(size_t bytes) : m_size{bytes} {
+  if (bytes == 0) {
+    return;
+  }
+
+  if (bytes < HUGE_PAGE_SIZE) {
+    m_data = ::operator new(round_up(bytes, ALIGNMENT), std::align_val_t{ALIGNMENT});
+    std::memset(m_data, 0, bytes);
+    return;
+  }
+
+  size_t mapping_size = round_up(bytes, HUGE_PAGE_SIZE);
+#ifdef MAP_HUGETLB
+  if (hugetlb_requested()) {
+    void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+      m_data = mapping;
+      m_mapping_size = mapping_size;
+      m_hugetlb = true;
+      return;
+    }
+  }
+#endif
+
+  // Over-allocate by one huge page so the buffer can start on a huge page
+  // boundary: the kernel only uses huge pages for aligned 2MB ranges
+  size_t reserved = mapping_size + HUGE_PAGE_SIZE;
+  void* mapping = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  auto* start = static_cast<char*>(mapping);
+  auto* aligned = reinterpret_cast<char*>(round_up(reinterpret_cast<size_t>(start), HUGE_PAGE_SIZE));
+  if (aligned > start) {
+    ::munmap(start, aligned - start);
+  }
+  if (size_t tail = (start + reserved) - (aligned + mapping_size)) {
+    ::munmap(aligned + mapping_size, tail);
+  }
+#ifdef MADV_HUGEPAGE
+  ::madvise(aligned, mapping_size, MADV_HUGEPAGE);
+#endif
+  m_data = aligned;
+  m_mapping_size = mapping_size;
+}
+
+TableBuffer::TableBuffer(TableBuffer&& other) noexcept {
+  *this = std::move(other);
+}
+
+TableBuffer& TableBuffer::operator=(TableBuffer&& other) noexcept {
+  if (this != &other) {
+    release();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_mapping_size = std::exchange(other.m_mapping_size, 0);
+    m_hugetlb = std::exchange(other.m_hugetlb, false);
+  }
+  return *this;
+}
+
+TableBuffer::~TableBuffer() {
+  release();
+}
+
+void TableBuffer::release() {
+  if (!m_data) {
+    return;
+  }
+  if (m_mapping_size) {
+    ::munmap(m_data, m_mapping_size);
+  } else {
+    ::operator delete(m_data, std::align_val_t{ALIGNMENT});
+  }
+  m_data = nullptr;
+}
+
+MappedFile::MappedFile(const std::string& path, const std::string& what) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open " + what + ": " + path);
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot open " + what + ": " + path);
+  }
+  if (st.st_size == 0) {
+    ::close(fd);
+    return;
+  }
+
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Cannot map " + what + ": " + path);
+  }
+  m_data = mapping;
+  m_size = size;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+  *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    release();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() {
+  release();
+}
+
+void MappedFile::advise_random() const {
+  if (m_data) {
+    ::madvise(m_data, m_size, MADV_RANDOM);
+  }
+}
+
+void MappedFile::release() {
+  if (m_data) {
+    ::munmap(m_data, m_size);
+    m_data = nullptr;
+  }
+}
+
+FileWriter::FileWriter(const std::string& path, const std::string& what, bool truncate)
+  : m_path{path}, m_what{what} {
+  m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+  if (m_fd < 0) {
+    fail("open");
+  }
+}
+
+FileWriter::~FileWriter() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+size_t FileWriter::size() const {
+  struct stat st;
+  if (::fstat(m_fd, &st) != 0) {
+    fail("read");
+  }
+  return static_cast<size_t>(st.st_size);
+}
+
+void FileWriter::resize(size_t size) {
+  if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+    fail("write");
+  }
+}
+
+void FileWriter::read_at(void* data, size_t size, size_t offset) const {
+  auto* bytes = static_cast<char*>(data);
+  while (size > 0) {
+    ssize_t n = ::pread(m_fd, bytes, size, static_cast<off_t>(offset));
+    if (n <= 0) {
+      fail("read");
+    }
+    bytes += n;
+    size -= static_cast<size_t>(n);
+    offset += static_cast<size_t>(n);
+  }
+}
+
+void FileWriter::write_at(const void* data, size_t size, size_t offset) {
+  const auto* bytes = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t n = ::pwrite(m_fd, bytes, size, static_cast<off_t>(offset));
+    if (n <= 0) {
+      fail("write");
+    }
+    bytes += n;
+    size -= static_cast<size_t>(n);
+    offset += static_cast<size_t>(n);
+  }
+}
+
+void FileWriter::sync() {
+  if (::fdatasync(m_fd) != 0) {
+    fail("write");
+  }
+}
+
+void FileWriter::fail(const char* action) const {
+  throw std::runtime_error(std::string("Cannot ") + action + " " + m_what + ": " + m_path);
+}
@@ -0,0 +1,152 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+ThreadPool::ThreadPool(size_t num_threads)
+  : m_slots{std::make_unique<Slot[]>(std::max<size_t>(num_threads, 1))} {
+  for (size_t slot = 1; slot < num_threads; ++slot) {
+    m_threads.emplace_back([this, slot] { work(slot); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+void ThreadPool::run(size_t n, size_t grain, Invoke invoke, const void* context) {
+  // The thread running the current loop must not lock its mutex again: a
+  // loop nested in one of its chunks runs inline without trying
+  std::unique_lock<std::mutex> loop;
+  if (m_loop_owner.load(std::memory_order_relaxed) != std::this_thread::get_id()) {
+    loop = std::unique_lock(m_loop_mutex, std::try_to_lock);
+  }
+  if (!loop || m_threads.empty() || n <= grain) {
+    for (size_t begin = 0; begin < n; begin += grain) {
+      invoke(context, begin, std::min(begin + grain, n));
+    }
+    return;
+  }
+  m_loop_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+  const size_t parts = num_threads();
+  for (size_t i = 0; i < parts; ++i) {
+    std::lock_guard lock(m_slots[i].mutex);
+    m_slots[i].begin = n * i / parts;
+    m_slots[i].end = n * (i + 1) / parts;
+  }
+  m_invoke = invoke;
+  m_context = context;
+  m_grain = grain;
+  m_remaining = n;
+  m_error = nullptr;
+
+  {
+    std::lock_guard lock(m_mutex);
+    ++m_generation;
+    m_active = true;
+  }
+  m_wake.notify_all();
+
+  participate(0);
+
+  {
+    // Workers waking up late find the loop over and leave it alone
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [&] { return m_remaining == 0 && m_inside == 0; });
+    m_active = false;
+  }
+  m_loop_owner.store(std::thread::id(), std::memory_order_relaxed);
+
+  if (m_error) {
+    std::rethrow_exception(std::exchange(m_error, nullptr));
+  }
+}
+
+void ThreadPool::work(size_t slot) {
+  uint64_t seen = 0;
+  for (;;) {
+    {
+      std::unique_lock lock(m_mutex);
+      m_wake.wait(lock, [&] { return m_stop || (m_active && m_generation != seen); });
+      if (m_stop) {
+        return;
+      }
+      seen = m_generation;
+      ++m_inside;
+    }
+
+    participate(slot);
+
+    {
+      std::lock_guard lock(m_mutex);
+      --m_inside;
+    }
+    m_idle.notify_all();
+  }
+}
+
+void ThreadPool::participate(size_t slot) {
+  size_t begin, end;
+  while (take(slot, begin, end) || steal(slot, begin, end)) {
+    try {
+      m_invoke(m_context, begin, end);
+    } catch (...) {
+      std::lock_guard lock(m_error_mutex);
+      if (!m_error) {
+        m_error = std::current_exception();
+      }
+    }
+
+    if (m_remaining.fetch_sub(end - begin) == end - begin) {
+      std::lock_guard lock(m_mutex);
+      m_idle.notify_all();
+    }
+  }
+}
+
+bool ThreadPool::take(size_t slot, size_t& begin, size_t& end) {
+  Slot& own = m_slots[slot];
+  std::lock_guard lock(own.mutex);
+  if (own.begin >= own.end) {
+    return false;
+  }
+  begin = own.begin;
+  end = std::min(own.begin + m_grain, own.end);
+  own.begin = end;
+  return true;
+}
+
+bool ThreadPool::steal(size_t slot, size_t& begin, size_t& end) {
+  const size_t parts = num_threads();
+  for (size_t k = 1; k < parts; ++k) {
+    Slot& victim = m_slots[(slot + k) % parts];
+    size_t stolen_begin, stolen_end;
+    {
+      std::lock_guard lock(victim.mutex);
+      if (victim.begin >= victim.end) {
+        continue;
+      }
+      // Back half, or the last index
+      stolen_begin = victim.begin + (victim.end - victim.begin) / 2;
+      stolen_end = victim.end;
+      victim.end = stolen_begin;
+    }
+
+    // Only the owner refills its slot, which is empty at this point
+    {
+      std::lock_guard lock(m_slots[slot].mutex);
+      m_slots[slot].begin = stolen_begin;
+      m_slots[slot].end = stolen_end;
+    }
+    return take(slot, begin, end);
+  }
+  return false;
+}
@@ -0,0 +1,104 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "utils.h"
+#include "evaluation.hpp"
+#include "hand_range.hpp"
+#include "range_evaluation.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count every heap allocation made by the test binary
+static std::atomic<size_t> num_allocations{0};
+
+void* operator new(std::size_t size) {
+  ++num_allocations;
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+  uint32_t card(const char* card_s) {
+    char buf[3] = {card_s[0], card_s[1], '\0'};
+    return card_from_string(buf);
+  }
+
+  template <typename Query>
+  size_t count_allocations(Query&& query) {
+    size_t before = num_allocations.load();
+    for (int i = 0; i < 20; ++i) {
+      query();
+    }
+    return num_allocations.load() - before;
+  }
+}
+
+TEST_CASE("repeated queries do not allocate", "[evaluate][allocations]") {
+  Evaluator evaluator;
+  evaluator.set_num_simulations(2000);
+
+  Situation situation;
+  situation.hands = {{card("As"), card("Ah")}, {card("Kd"), card("Kc")}};
+
+  EvalScratch scratch;
+  for (auto board : {"", "Ts 9h 8d", "Ts 9h 8d 2c", "Ts 9h 8d 2c 3c"}) {
+    situation.board.clear();
+    for (const char* c = board; *c; c += (c[2] ? 3 : 2)) {
+      situation.board.push_back(card(c));
+    }
+
+    // The first query grows the scratch buffers
+    evaluator.evaluate(situation);
+    evaluator.evaluate(situation, scratch);
+
+    REQUIRE(count_allocations([&] { evaluator.evaluate(situation); }) == 0);
+    REQUIRE(count_allocations([&] { evaluator.evaluate(situation, scratch); }) == 0);
+    if (situation.board.size() == 3 || situation.board.size() == 4) {
+      REQUIRE(count_allocations([&] { evaluator.outs(situation); }) == 0);
+    }
+  }
+
+  SECTION("stateful interface") {
+    std::vector<uint32_t> hands = {card("As"), card("Ah"), card("Kd"), card("Kc")};
+    std::vector<uint32_t> board = {card("Ts"), card("9h"), card("8d")};
+    evaluator.set_hands(hands.begin(), hands.end());
+    evaluator.evaluate();
+
+    REQUIRE(count_allocations([&] {
+      evaluator.set_hands(hands.begin(), hands.end());
+      evaluator.set_board(board.begin(), board.end());
+      evaluator.evaluate();
+    }) == 0);
+  }
+
+  SECTION("range evaluation") {
+    HandRange range;
+    range.addHand(card("Kd"), card("Kc"));
+    range.addHand(card("Qd"), card("Qc"), 0.5f);
+    range.addHand(card("Jd"), card("Jc"));
+
+    RangeEvaluator range_evaluator;
+    range_evaluator.set_num_simulations(500);
+    auto hero = std::make_pair(card("As"), card("Ah"));
+    range_evaluator.evaluate(hero, range);
+
+    REQUIRE(count_allocations([&] { range_evaluator.evaluate(hero, range); }) == 0);
+  }
+}
@@ -0,0 +1,264 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "board_classes.hpp"
+#include "bucket_table.hpp"
+#include "card_index.h"
+#include "card_set.h"
+#include "evaluation.hpp"
+#include "flop_database.hpp"
+#include "rng.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  // The board and hole cards with their suits permuted and the board shuffled
+  std::pair<BoardClasses::Board, std::array<uint32_t, 2>> random_isomorph(BoardClasses::Board board,
+                                                                          std::array<uint32_t, 2> hole,
+                                                                          Philox4x32& rng) {
+    BoardClasses::SuitPermutation suits = {0, 1, 2, 3};
+    for (int i = 3; i > 0; --i) {
+      std::swap(suits[i], suits[rng.bounded(i + 1)]);
+    }
+    for (auto& card : board) {
+      card = BoardClasses::permute(card, suits);
+    }
+    for (auto& card : hole) {
+      card = BoardClasses::permute(card, suits);
+    }
+    for (size_t i = board.size() - 1; i > 0; --i) {
+      std::swap(board[i], board[rng.bounded(static_cast<uint32_t>(i + 1))]);
+    }
+    return {board, hole};
+  }
+
+  std::array<uint32_t, 2> random_hole(const BoardClasses::Board& board, Philox4x32& rng) {
+    CardSet used(board.begin(), board.end());
+    std::array<uint32_t, 2> hole{};
+    for (auto& card : hole) {
+      do {
+        card = card_at(rng.bounded(52));
+      } while (used.contains(card));
+      used.insert(card);
+    }
+    return hole;
+  }
+}
+
+TEST_CASE("board classes", "[buckets]") {
+  REQUIRE(BoardClasses::of(3).size() == FlopDatabase::NUM_FLOPS);
+  REQUIRE(BoardClasses::of(4).size() == 16432);
+  REQUIRE(BoardClasses::of(5).size() == 134459);
+
+  // Flops are numbered as in the flop database
+  for (size_t flop = 0; flop < FlopDatabase::NUM_FLOPS; ++flop) {
+    auto canonical = FlopDatabase::canonical_flop(flop);
+    auto board = BoardClasses::of(3).board(flop);
+    REQUIRE(std::equal(board.begin(), board.end(), canonical.begin()));
+  }
+
+  Philox4x32 rng(49);
+  for (size_t board_size = 3; board_size <= 5; ++board_size) {
+    const auto& classes = BoardClasses::of(board_size);
+    for (int i = 0; i < 200; ++i) {
+      size_t index = rng.bounded(static_cast<uint32_t>(classes.size()));
+      auto board = classes.board(index);
+      REQUIRE(classes.classify(board).index == index);
+
+      // Isomorphs share the class, and the permutation takes them to its
+      // representative
+      auto [isomorph, hole] = random_isomorph(board, {card_at(0), card_at(1)}, rng);
+      auto canonical = classes.classify(isomorph);
+      REQUIRE(canonical.index == index);
+      CardSet image;
+      for (uint32_t card : isomorph) {
+        image.insert(BoardClasses::permute(card, canonical.suits));
+      }
+      REQUIRE(image == CardSet(board.begin(), board.end()));
+    }
+  }
+}
+
+TEST_CASE("bucketing features", "[buckets]") {
+  Evaluator evaluator;
+  HandRange all;
+  for (int second = 1; second < 52; ++second) {
+    for (int first = 0; first < second; ++first) {
+      all.addHand(card_at(first), card_at(second));
+    }
+  }
+
+  std::vector<float> features;
+  std::vector<bool> valid;
+  Philox4x32 rng(50);
+
+  SECTION("river features are the equities against the range") {
+    auto board = BoardClasses::of(5).board(1234);
+    BucketTable::features(board, HandRange(), 10, features, valid);
+    REQUIRE(features.size() == BucketTable::NUM_COMBOS);
+
+    for (int i = 0; i < 20; ++i) {
+      auto hole = random_hole(board, rng);
+      Situation situation;
+      situation.hands.push_back(hole);
+      situation.board = board;
+      size_t combo = BucketTable::combo_index(card_index(hole[0]), card_index(hole[1]));
+      REQUIRE(valid[combo]);
+      REQUIRE(features[combo] == Approx(evaluator.potential(situation, all).hand_strength).margin(1e-5));
+    }
+
+    // Combos holding a board card are left out
+    REQUIRE_FALSE(valid[BucketTable::combo_index(card_index(board[0]), card_index(board[1]))]);
+  }
+
+  SECTION("turn features are cumulative equity histograms") {
+    constexpr size_t bins = 8;
+    auto board = BoardClasses::of(4).board(4321);
+    BucketTable::features(board, HandRange(), bins, features, valid);
+    REQUIRE(features.size() == BucketTable::NUM_COMBOS * bins);
+
+    for (int i = 0; i < 10; ++i) {
+      auto hole = random_hole(board, rng);
+      size_t combo = BucketTable::combo_index(card_index(hole[0]), card_index(hole[1]));
+      const float* cdf = features.data() + combo * bins;
+      REQUIRE(std::is_sorted(cdf, cdf + bins));
+      REQUIRE(cdf[bins - 1] == Approx(1.f));
+
+      // The area above the histogram is the mean river equity, up to a bin
+      float area = 0;
+      for (size_t bin = 0; bin < bins; ++bin) {
+        area += (1.f - cdf[bin]) / bins;
+      }
+      Situation situation;
+      situation.hands.push_back(hole);
+      situation.board = board;
+      float ehs = evaluator.potential(situation, all).ehs;
+      REQUIRE(area <= ehs + 1e-5f);
+      REQUIRE(area >= ehs - 1.f / bins - 1e-5f);
+    }
+  }
+}
+
+TEST_CASE("bucket table generation and lookup", "[buckets]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_buckets.bin";
+  std::filesystem::remove(path);
+
+  BucketTable::GenerateOptions options;
+  options.num_buckets = 4;
+  options.num_bins = 8;
+  options.sample_boards = 3;
+  options.max_boards = 6;
+  options.num_threads = 2;
+  BucketTable::generate(path.string(), options);
+
+  auto table = BucketTable::load(path.string());
+  REQUIRE(table.num_buckets() == 4);
+
+  Philox4x32 rng(51);
+  for (size_t board_size = 3; board_size <= 5; ++board_size) {
+    const auto& classes = BoardClasses::of(board_size);
+    REQUIRE(table.num_boards(board_size) == 6);
+
+    for (size_t index = 0; index < 6; ++index) {
+      auto board = classes.board(index);
+      for (int i = 0; i < 20; ++i) {
+        auto hole = random_hole(board, rng);
+        auto bucket = table.bucket(hole, board);
+        REQUIRE(bucket);
+        REQUIRE(*bucket < 4);
+
+        auto [isomorph, isomorph_hole] = random_isomorph(board, hole, rng);
+        REQUIRE(table.bucket(isomorph_hole, isomorph) == bucket);
+      }
+    }
+
+    // Boards past those written are not in the table
+    auto missing = classes.board(classes.size() - 1);
+    REQUIRE_FALSE(table.bucket(random_hole(missing, rng), missing));
+  }
+
+  // On the river, buckets follow the equity
+  auto river = BoardClasses::of(5).board(3);
+  std::vector<float> features;
+  std::vector<bool> valid;
+  BucketTable::features(river, HandRange(), options.num_bins, features, valid);
+  std::vector<size_t> combos;
+  for (size_t c = 0; c < BucketTable::NUM_COMBOS; ++c) {
+    if (valid[c]) combos.push_back(c);
+  }
+  std::sort(combos.begin(), combos.end(), [&](size_t a, size_t b) { return features[a] < features[b]; });
+
+  auto bucket_of = [&](size_t combo) {
+    size_t second = 1;
+    while ((second + 1) * second / 2 <= combo) ++second;
+    std::array<uint32_t, 2> hole = {card_at(static_cast<int>(combo - second * (second - 1) / 2)),
+                                    card_at(static_cast<int>(second))};
+    return *table.bucket(hole, river);
+  };
+  for (size_t i = 1; i < combos.size(); ++i) {
+    REQUIRE(bucket_of(combos[i - 1]) <= bucket_of(combos[i]));
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("bucket table leaves out combos the range cannot face", "[buckets]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_narrow_buckets.bin";
+
+  BucketTable::GenerateOptions options;
+  options.num_buckets = 2;
+  options.num_bins = 4;
+  options.sample_boards = 2;
+  options.max_boards = 1;
+  // Every pair of deuces: the first boards hold 2s, and 2h 2d block the rest
+  for (int second = 1; second < 4; ++second) {
+    for (int first = 0; first < second; ++first) {
+      options.range.addHand(card_at(first * 13), card_at(second * 13));
+    }
+  }
+  BucketTable::generate(path.string(), options);
+  auto table = BucketTable::load(path.string());
+  std::filesystem::remove(path);
+
+  Philox4x32 rng(49);
+  for (size_t board_size = 3; board_size <= 5; ++board_size) {
+    auto board = BoardClasses::of(board_size).board(0);
+    const std::array<uint32_t, 2> blocked = {card_at(13), card_at(26)}; // 2h 2d
+    const std::array<uint32_t, 2> open = {card_at(13), card_at(50)};    // 2h Kc
+    REQUIRE_FALSE(table.bucket(blocked, board));
+    REQUIRE(table.bucket(open, board));
+
+    for (int i = 0; i < 20; ++i) {
+      auto [blocked_board, blocked_hole] = random_isomorph(board, blocked, rng);
+      REQUIRE_FALSE(table.bucket(blocked_hole, blocked_board));
+      auto [open_board, open_hole] = random_isomorph(board, open, rng);
+      REQUIRE(table.bucket(open_hole, open_board) == table.bucket(open, board));
+    }
+  }
+}
+
+TEST_CASE("bucket table rejects invalid input", "[buckets]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_not_buckets.bin";
+  std::filesystem::remove(path);
+  REQUIRE_THROWS_AS(BucketTable::load(path.string()), std::runtime_error);
+
+  BucketTable::GenerateOptions options;
+  options.num_buckets = 255;
+  REQUIRE_THROWS_AS(BucketTable::generate(path.string(), options), std::invalid_argument);
+  options.num_buckets = 0;
+  REQUIRE_THROWS_AS(BucketTable::generate(path.string(), options), std::invalid_argument);
+
+  // The table is indexed by suit-isomorphism class
+  options.num_buckets = 2;
+  options.range.addHand(card_at(12), card_at(25)); // As Ah
+  REQUIRE_THROWS_AS(BucketTable::generate(path.string(), options), std::invalid_argument);
+  std::filesystem::remove(path);
+}
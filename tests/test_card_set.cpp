@@ -0,0 +1,64 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "utils.h"
+#include "card_set.h"
+#include "card_index.h"
+#include "eval.h"
+#include "bitset_rankindex.h"
+
+#include <vector>
+
+TEST_CASE("card_index follows the initialize_deck order", "[cards][card_set]") {
+  auto deck = initialize_deck();
+  for (int i = 0; i < 52; ++i) {
+    REQUIRE(card_index(deck[i]) == i);
+    REQUIRE(card_at(i) == deck[i]);
+  }
+}
+
+TEST_CASE("CardSet membership and dead-card removal", "[cards][card_set]") {
+  auto deck = initialize_deck();
+  uint32_t as = card_from_rank_suit(14, SPADES);
+  uint32_t kh = card_from_rank_suit(13, HEARTS);
+
+  CardSet dead;
+  REQUIRE(dead.empty());
+  dead.insert(as);
+  dead.insert(kh);
+  REQUIRE(dead.size() == 2);
+  REQUIRE(dead.contains(as));
+  REQUIRE_FALSE(dead.contains(card_from_rank_suit(14, HEARTS)));
+
+  CardSet live = CardSet::full() - dead;
+  REQUIRE(live.size() == 50);
+  REQUIRE_FALSE(live.intersects(dead));
+  REQUIRE((live | dead) == CardSet::full());
+
+  std::vector<uint32_t> cards;
+  live.for_each([&](uint32_t card) { cards.push_back(card); });
+  std::vector<uint32_t> expected;
+  for (uint32_t card : deck) {
+    if (card != as && card != kh) expected.push_back(card);
+  }
+  REQUIRE(cards == expected);
+
+  dead.erase(as);
+  REQUIRE(dead == CardSet(&kh, &kh + 1));
+}
+
+TEST_CASE("index-encoded hands evaluate like Cactus-Kev hands", "[cards][evaluate]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  auto deck = initialize_deck();
+
+  std::array<uint32_t, 7> hand{deck[12], deck[25], deck[5], deck[44], deck[0], deck[13], deck[50]};
+  std::array<CardIndex, 7> indices = to_indices(hand);
+
+  REQUIRE(indices == std::array<CardIndex, 7>{12, 25, 5, 44, 0, 13, 50});
+  REQUIRE(to_cards(indices) == hand);
+  REQUIRE(eval7(hash, indices) == eval7(hash, hand));
+}
@@ -0,0 +1,123 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "utils.h"
+#include "eval.h"
+#include "bitset_rankindex.h"
+#include "card_index.h"
+#include "card_set.h"
+#include "combinations.h"
+#include "evaluation.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+  std::vector<uint32_t> cards(const std::string& cards_s) {
+    std::vector<uint32_t> result;
+    for (size_t pos = 0; pos + 1 < cards_s.size(); pos += 3) {
+      char card_str[3] = {cards_s[pos], cards_s[pos + 1], '\0'};
+      result.push_back(card_from_string(card_str));
+    }
+    return result;
+  }
+}
+
+TEST_CASE("combinations are enumerated in colex order", "[combinations]") {
+  REQUIRE(binomial(45, 2) == 990);
+  REQUIRE(binomial(52, 5) == 2598960);
+  REQUIRE(binomial(52, 7) == 133784560);
+  REQUIRE(binomial(3, 4) == 0);
+
+  static_assert(Combinations<5>::all<7>().size() == 21);
+  static_assert(Combinations<2>::unrank(989) == Combinations<2>::Combination{43, 44});
+
+  // Brute force: every 3-subset of 12 elements, sorted by largest element first
+  std::vector<Combinations<3>::Combination> expected;
+  for (uint8_t c = 2; c < 12; ++c) {
+    for (uint8_t b = 1; b < c; ++b) {
+      for (uint8_t a = 0; a < b; ++a) {
+        expected.push_back({a, b, c});
+      }
+    }
+  }
+
+  auto c = Combinations<3>::first();
+  for (size_t r = 0; r < expected.size(); ++r) {
+    REQUIRE(c == expected[r]);
+    REQUIRE(Combinations<3>::rank(c) == r);
+    REQUIRE(Combinations<3>::unrank(r) == c);
+
+    auto before = c;
+    size_t changed = Combinations<3>::next(c);
+    for (size_t i = changed + 1; i < 3; ++i) {
+      REQUIRE(c[i] == before[i]);
+    }
+    REQUIRE(c[changed] != before[changed]);
+  }
+}
+
+TEST_CASE("folding combinations reuses the shared elements", "[combinations]") {
+  // Fold the elements into a sum, and count the additions
+  size_t additions = 0;
+  auto add = [&](uint64_t sum, uint8_t element) {
+    ++additions;
+    return sum * 64 + element;
+  };
+
+  for (auto [begin, end] : {std::pair<uint64_t, uint64_t>{0, 990}, {17, 500}, {989, 990}}) {
+    additions = 0;
+    uint64_t r = begin;
+    fold_combinations<2>(begin, end, uint64_t{0}, add, [&](const auto& c, uint64_t sum) {
+      REQUIRE(Combinations<2>::rank(c) == r++);
+      REQUIRE(sum == uint64_t{c[1]} * 64 + c[0]);
+    });
+    REQUIRE(r == end);
+
+    // One addition per combination, plus one per distinct largest element
+    size_t largest = Combinations<2>::unrank(end - 1)[1] - Combinations<2>::unrank(begin)[1] + 1;
+    REQUIRE(additions == (end - begin) + largest);
+  }
+}
+
+TEST_CASE("multi-way flop enumeration deals every runout once", "[combinations][evaluate]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  auto hands = cards("As Kd Qh Qc 7s 6s Jd Td");
+  auto board = cards("Ks 7h 2h");
+
+  for (size_t num_players = 2; num_players <= 4; ++num_players) {
+    Evaluator evaluator;
+    evaluator.set_hands(hands.begin(), hands.begin() + 2 * num_players);
+    evaluator.set_board(board.begin(), board.end());
+
+    CardSet known(board.begin(), board.end());
+    known |= CardSet(hands.begin(), hands.begin() + 2 * num_players);
+    std::vector<uint32_t> deck;
+    (CardSet::full() - known).for_each([&](uint32_t card) { deck.push_back(card); });
+
+    int wins = 0, ties = 0, total = 0;
+    for (size_t river = 1; river < deck.size(); ++river) {
+      for (size_t turn = 0; turn < river; ++turn) {
+        std::vector<uint16_t> ranks;
+        for (size_t p = 0; p < num_players; ++p) {
+          ranks.push_back(eval7(hash, std::array<uint32_t, 7>{hands[2 * p], hands[2 * p + 1], board[0], board[1],
+                                                              board[2], deck[turn], deck[river]}));
+        }
+        uint16_t best_other = *std::min_element(ranks.begin() + 1, ranks.end());
+        wins += ranks[0] < best_other;
+        ties += ranks[0] == best_other;
+        ++total;
+      }
+    }
+    REQUIRE(total == static_cast<int>(binomial(45 - 2 * (num_players - 2), 2)));
+
+    auto result = evaluator.evaluate();
+    REQUIRE(result.win_prob == static_cast<float>(wins) / static_cast<float>(total));
+    REQUIRE(result.tie_prob == static_cast<float>(ties) / static_cast<float>(total));
+  }
+}
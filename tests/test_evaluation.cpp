@@ -0,0 +1,730 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "utils.h"
+#include "evaluation.hpp"
+#include "hand_range.hpp"
+#include "range_evaluation.hpp"
+#include "card_set.h"
+#include "eval.h"
+#include "bitset_rankindex.h"
+#include "preflop_tables.h"
+#include "rng.h"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+  std::vector<uint32_t> cards(const std::string& cards_s) {
+    std::vector<uint32_t> result;
+    for (size_t pos = 0; pos + 1 < cards_s.size(); pos += 3) {
+      char card_str[3] = {cards_s[pos], cards_s[pos + 1], '\0'};
+      result.push_back(card_from_string(card_str));
+    }
+    return result;
+  }
+
+  Situation make_situation(const std::string& hands_s, const std::string& board_s) {
+    Situation situation;
+    auto hands = cards(hands_s);
+    for (size_t i = 0; i + 1 < hands.size(); i += 2) {
+      situation.hands.push_back({hands[i], hands[i + 1]});
+    }
+    for (uint32_t card : cards(board_s)) {
+      situation.board.push_back(card);
+    }
+    return situation;
+  }
+
+  Evaluator make_evaluator(const std::string& hands_s, const std::string& board_s) {
+    Evaluator evaluator;
+    auto hands = cards(hands_s);
+    auto board = cards(board_s);
+    evaluator.set_hands(hands.begin(), hands.end());
+    evaluator.set_board(board.begin(), board.end());
+    return evaluator;
+  }
+}
+
+TEST_CASE("outs on the turn count winning and tying rivers", "[outs]") {
+  auto evaluator = make_evaluator("7h 7d Ac Kh", "2s 3c 4d 5h");
+  auto result = evaluator.outs();
+
+  REQUIRE(result.leaders == 0b10);
+  REQUIRE(result.cards.size() == 44);
+  REQUIRE(result.players[0].outs == 4);
+  REQUIRE(result.players[0].tie_outs == 3);
+  REQUIRE(result.players[1].outs == 0);
+  REQUIRE(result.players[1].tie_outs == 3);
+  REQUIRE_FALSE(result.players[0].drawing_dead);
+  REQUIRE_FALSE(result.players[1].drawing_dead);
+}
+
+TEST_CASE("outs on the flop look through to the river", "[outs]") {
+  SECTION("runner-runner draw is live") {
+    auto result = make_evaluator("As Kh Qd Jc", "Ts 9h 8d").outs();
+    REQUIRE(result.leaders == 0b10);
+    REQUIRE(result.cards.size() == 45);
+    REQUIRE(result.players[0].outs == 0);
+    REQUIRE_FALSE(result.players[0].drawing_dead);
+  }
+
+  SECTION("redraws after being outdrawn on the turn") {
+    auto result = make_evaluator("As Ah Kd Kc", "2s 7h 9d").outs();
+    REQUIRE(result.leaders == 0b01);
+    REQUIRE(result.players[1].outs == 2);
+    REQUIRE(result.players[0].redraws == 2);
+    REQUIRE(result.players[1].redraws == 0);
+  }
+
+  SECTION("drawing dead") {
+    auto result = make_evaluator("2c 3d Ac Kd", "Ah Ad As").outs();
+    REQUIRE(result.players[0].drawing_dead);
+    REQUIRE(result.players[0].outs == 0);
+    REQUIRE(result.players[0].tie_outs == 0);
+    REQUIRE_FALSE(result.players[1].drawing_dead);
+  }
+}
+
+TEST_CASE("Monte Carlo simulations are reproducible from the seed", "[simulate][rng]") {
+  auto hands = cards("As Ah Kd Kc 7h 2c");
+  std::vector<uint16_t> first(3000), second(3000), sharded(3000);
+
+  Evaluator evaluator(42);
+  evaluator.set_hands(hands.begin(), hands.end());
+
+  REQUIRE(evaluator.simulate(first.data(), 1000) == 1000);
+  REQUIRE(evaluator.simulate(second.data(), 1000) == 1000);
+  REQUIRE(first == second);
+
+  SECTION("shards match the unsharded run") {
+    evaluator.simulate(sharded.data(), 400, 0);
+    evaluator.simulate(sharded.data() + 400 * 3, 600, 400);
+    REQUIRE(first == sharded);
+  }
+
+  SECTION("other seeds give other samples") {
+    evaluator.set_seed(43);
+    evaluator.simulate(second.data(), 1000);
+    REQUIRE(first != second);
+  }
+}
+
+TEST_CASE("one evaluator can be queried from many threads", "[evaluate][threads]") {
+  Evaluator evaluator;
+  evaluator.set_num_simulations(20000);
+
+  std::vector<Situation> situations = {
+    make_situation("As Ah Kd Kc", ""),
+    make_situation("As Kh Qd Jc", "Ts 9h 8d"),
+    make_situation("7h 7d Ac Kh", "2s 3c 4d 5h"),
+  };
+
+  std::vector<EvalResult> expected;
+  for (const auto& situation : situations) {
+    expected.push_back(evaluator.evaluate(situation));
+  }
+
+  std::vector<std::vector<EvalResult>> actual(4);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < actual.size(); ++t) {
+    threads.emplace_back([&, t] {
+      for (int repeat = 0; repeat < 3; ++repeat) {
+        for (const auto& situation : situations) {
+          actual[t].push_back(evaluator.evaluate(situation));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& results : actual) {
+    REQUIRE(results.size() == 3 * situations.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      REQUIRE(results[i].win_prob == expected[i % situations.size()].win_prob);
+      REQUIRE(results[i].tie_prob == expected[i % situations.size()].tie_prob);
+    }
+  }
+}
+
+TEST_CASE("evaluation needs an opponent hand", "[evaluate]") {
+  Evaluator evaluator;
+  REQUIRE_THROWS_AS(evaluator.evaluate(make_situation("As Ah", "")), std::invalid_argument);
+  REQUIRE_THROWS_AS(evaluator.evaluate(make_situation("As Ah", "Ts 9h 8d")), std::invalid_argument);
+  REQUIRE_THROWS_AS(evaluator.evaluate(Situation{}), std::invalid_argument);
+}
+
+TEST_CASE("range evaluation skips blocked combos", "[range]") {
+  auto hero = cards("As Ah");
+  auto villain = cards("Kd Kc As Kh Ah Qc");
+
+  HandRange range;
+  range.addHand(villain[0], villain[1]);
+  range.addHand(villain[2], villain[3]);
+  range.addHand(villain[4], villain[5]);
+
+  HandRange unblocked;
+  unblocked.addHand(villain[0], villain[1]);
+
+  RangeEvaluator range_evaluator;
+  range_evaluator.set_num_simulations(5000);
+  auto result = range_evaluator.evaluate({hero[0], hero[1]}, range);
+  auto expected = range_evaluator.evaluate({hero[0], hero[1]}, unblocked);
+
+  REQUIRE(result.win_prob == expected.win_prob);
+  REQUIRE(result.tie_prob == expected.tie_prob);
+}
+
+TEST_CASE("exact range evaluation matches pairwise comparisons", "[range]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  Philox4x32 rng(7);
+
+  for (size_t board_size : {4, 5}) {
+    std::vector<uint32_t> deck(CARD_FROM_INDEX.begin(), CARD_FROM_INDEX.end());
+    std::shuffle(deck.begin(), deck.end(), rng);
+    std::vector<uint32_t> board(deck.begin(), deck.begin() + board_size);
+
+    // Overlapping ranges, with some combos blocked by the board
+    HandRange hero, villain;
+    for (int i = 0; i < 60; ++i) {
+      uint32_t a = CARD_FROM_INDEX[rng.bounded(52)];
+      uint32_t b = CARD_FROM_INDEX[rng.bounded(52)];
+      if (a == b) continue;
+      hero.addHand(a, b);
+      villain.addHand(b, a, static_cast<float>(rng.bounded(5)) / 4.f);
+    }
+
+    RangeEvaluator range_evaluator;
+    range_evaluator.set_board(board.begin(), board.end());
+    auto results = range_evaluator.evaluate(hero, villain);
+    REQUIRE(results.size() == hero.hands().size());
+
+    // Every complete board the hands can be played out on
+    std::vector<std::vector<uint32_t>> runouts;
+    if (board_size == 5) {
+      runouts.push_back(board);
+    } else {
+      (CardSet::full() - CardSet(board.begin(), board.end())).for_each([&](uint32_t river) {
+        runouts.push_back(board);
+        runouts.back().push_back(river);
+      });
+    }
+
+    for (size_t i = 0; i < hero.hands().size(); ++i) {
+      auto h = hero.hands()[i].hand;
+      double win = 0, tie = 0, total = 0;
+
+      for (const auto& full_board : runouts) {
+        CardSet dead(full_board.begin(), full_board.end());
+        if (dead.contains(h.first) || dead.contains(h.second)) continue;
+        dead.insert(h.first);
+        dead.insert(h.second);
+
+        auto rank = [&](std::pair<uint32_t, uint32_t> hand) {
+          return eval7(hash, std::array<uint32_t, 7>{hand.first, hand.second, full_board[0], full_board[1],
+                                                     full_board[2], full_board[3], full_board[4]});
+        };
+        for (const auto& [v, w] : villain.hands()) {
+          if (w == 0.f || dead.contains(v.first) || dead.contains(v.second)) continue;
+          uint16_t hero_rank = rank(h);
+          uint16_t villain_rank = rank(v);
+          win += hero_rank < villain_rank ? w : 0;
+          tie += hero_rank == villain_rank ? w : 0;
+          total += w;
+        }
+      }
+
+      if (total == 0) {
+        REQUIRE(results[i].win_prob == 0.f);
+        REQUIRE(results[i].tie_prob == 0.f);
+      } else {
+        REQUIRE(results[i].win_prob == Approx(win / total).margin(1e-6));
+        REQUIRE(results[i].tie_prob == Approx(tie / total).margin(1e-6));
+      }
+    }
+  }
+}
+
+TEST_CASE("exact flop and turn equity of a hand agrees with enumeration", "[range]") {
+  auto hero = cards("As Ah");
+  auto villain = cards("Kd Kc Qh Jh Ts 9s");
+
+  HandRange range;
+  range.addHand(villain[0], villain[1]);
+  range.addHand(villain[2], villain[3], 0.5f);
+  range.addHand(villain[4], villain[5], 0.25f);
+
+  for (const std::string board_s : {"Ks 7h 2h", "Ks 7h 2h 3c"}) {
+    auto board = cards(board_s);
+
+    RangeEvaluator range_evaluator;
+    range_evaluator.set_board(board.begin(), board.end());
+    auto result = range_evaluator.evaluate({hero[0], hero[1]}, range);
+
+    double win = 0, tie = 0, total = 0;
+    for (size_t i = 0; i < range.hands().size(); ++i) {
+      auto [v, w] = range.hands()[i];
+      Evaluator evaluator;
+      std::vector<uint32_t> hands = {hero[0], hero[1], v.first, v.second};
+      evaluator.set_hands(hands.begin(), hands.end());
+      evaluator.set_board(board.begin(), board.end());
+      auto r = evaluator.evaluate();
+      win += r.win_prob * w;
+      tie += r.tie_prob * w;
+      total += w;
+    }
+
+    REQUIRE(result.win_prob == Approx(win / total).margin(1e-6));
+    REQUIRE(result.tie_prob == Approx(tie / total).margin(1e-6));
+  }
+}
+
+TEST_CASE("range changes are applied incrementally", "[range]") {
+  auto hero = cards("As Ah");
+  auto villain = cards("Kd Kc Qh Jh Ts 9s 8c 8d Ac Kh");
+
+  for (const std::string board_s : {"", "Ks 7h 2h"}) {
+    auto board = cards(board_s);
+
+    HandRange range;
+    range.addHand(villain[0], villain[1]);
+    range.addHand(villain[2], villain[3], 0.5f);
+
+    RangeEvaluator incremental;
+    incremental.set_num_simulations(2000);
+    incremental.set_board(board.begin(), board.end());
+    incremental.evaluate({hero[0], hero[1]}, range);
+
+    uint64_t epoch = range.epoch();
+    range.addHand(villain[4], villain[5], 0.25f);
+    range.addHand(villain[6], villain[7]);
+    range.addHand(villain[8], villain[9]);
+    range.setWeight(1, 1.f);
+    range.removeHand(0);
+    REQUIRE(range.epoch() == epoch);
+    REQUIRE(range.changes().size() == 7);
+
+    auto result = incremental.evaluate({hero[0], hero[1]}, range);
+
+    RangeEvaluator from_scratch;
+    from_scratch.set_num_simulations(2000);
+    from_scratch.set_board(board.begin(), board.end());
+    auto expected = from_scratch.evaluate({hero[0], hero[1]}, range);
+
+    REQUIRE(result.win_prob == Approx(expected.win_prob).margin(1e-6));
+    REQUIRE(result.tie_prob == Approx(expected.tie_prob).margin(1e-6));
+  }
+}
+
+TEST_CASE("hands can be given as compact card indices", "[evaluate][cards]") {
+  auto hands = cards("As Kh Qd Jc");
+  auto board = cards("Ts 9h 8d");
+  std::vector<CardIndex> hand_indices, board_indices;
+  for (uint32_t card : hands) hand_indices.push_back(card_index(card));
+  for (uint32_t card : board) board_indices.push_back(card_index(card));
+
+  Evaluator by_card, by_index;
+  by_card.set_hands(hands.begin(), hands.end());
+  by_card.set_board(board.begin(), board.end());
+  by_index.set_hand_indices(hand_indices.begin(), hand_indices.end());
+  by_index.set_board_indices(board_indices.begin(), board_indices.end());
+
+  REQUIRE(by_index.hands() == by_card.hands());
+  REQUIRE(by_index.board() == by_card.board());
+  REQUIRE(by_index.evaluate().win_prob == by_card.evaluate().win_prob);
+}
+
+TEST_CASE("shared board preprocessing ranks every hand like eval7", "[simulate]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  auto situation = make_situation("As Ah Kd Kc 7h 6h Qs Js", "Th 9h 2c 3d");
+
+  Evaluator evaluator;
+  std::vector<uint16_t> results(40 * 4);
+  REQUIRE(evaluator.simulate(situation, results.data(), 0) == 40);
+
+  // Rivers are dealt in deck order
+  CardSet known(situation.board.begin(), situation.board.end());
+  for (const auto& hole : situation.hands) {
+    known.insert(hole[0]);
+    known.insert(hole[1]);
+  }
+  size_t row = 0;
+  (CardSet::full() - known).for_each([&](uint32_t river) {
+    for (size_t p = 0; p < situation.hands.size(); ++p) {
+      std::array<uint32_t, 7> hand = {
+        situation.hands[p][0], situation.hands[p][1],
+        situation.board[0], situation.board[1], situation.board[2], situation.board[3], river
+      };
+      REQUIRE(results[row * 4 + p] == eval7(hash, hand));
+    }
+    ++row;
+  });
+  REQUIRE(row == 40);
+}
+
+TEST_CASE("dead cards are never dealt", "[evaluate][dead_cards]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  auto dead = cards("Ac Kc 5h 5d 2s");
+
+  SECTION("flops and turns are enumerated over the remaining deck") {
+    for (const std::string board_s : {"Qc Jc 4h", "Qc Jc 4h 9s"}) {
+      auto situation = make_situation("As Ad Tc 9c", board_s);
+      situation.dead = CardSet(dead.begin(), dead.end());
+
+      CardSet known = situation.dead | CardSet(situation.board.begin(), situation.board.end());
+      for (const auto& hole : situation.hands) {
+        known |= CardSet(hole.begin(), hole.end());
+      }
+      std::vector<uint32_t> deck;
+      (CardSet::full() - known).for_each([&](uint32_t card) { deck.push_back(card); });
+
+      // Brute force over the runouts of the remaining cards
+      int wins = 0, ties = 0, total = 0;
+      auto rank = [&](size_t p, const std::array<uint32_t, 5>& board) {
+        return eval7(hash, std::array<uint32_t, 7>{situation.hands[p][0], situation.hands[p][1],
+                                                   board[0], board[1], board[2], board[3], board[4]});
+      };
+      auto count = [&](const std::array<uint32_t, 5>& board) {
+        auto hero = rank(0, board);
+        auto villain = rank(1, board);
+        wins += hero < villain;
+        ties += hero == villain;
+        ++total;
+      };
+      const auto& b = situation.board;
+      if (b.size() == 3) {
+        for (size_t river = 1; river < deck.size(); ++river) {
+          for (size_t turn = 0; turn < river; ++turn) {
+            count({b[0], b[1], b[2], deck[turn], deck[river]});
+          }
+        }
+      } else {
+        for (uint32_t river : deck) {
+          count({b[0], b[1], b[2], b[3], river});
+        }
+      }
+
+      Evaluator evaluator;
+      auto result = evaluator.evaluate(situation);
+      REQUIRE(result.win_prob == static_cast<float>(wins) / static_cast<float>(total));
+      REQUIRE(result.tie_prob == static_cast<float>(ties) / static_cast<float>(total));
+
+      // The same through the setters
+      auto hands = cards("As Ad Tc 9c");
+      auto board = cards(board_s);
+      evaluator.set_hands(hands.begin(), hands.end());
+      evaluator.set_board(board.begin(), board.end());
+      evaluator.set_dead_cards(dead.begin(), dead.end());
+      REQUIRE(evaluator.evaluate().win_prob == result.win_prob);
+    }
+  }
+
+  SECTION("Monte Carlo deals from the remaining deck") {
+    // Leave exactly five cards to deal: every simulation gets the same board
+    auto situation = make_situation("As Ad Tc 9c", "");
+    auto board = cards("Kh Qh Jh 2d 3d");
+    CardSet kept(board.begin(), board.end());
+    for (const auto& hole : situation.hands) {
+      kept |= CardSet(hole.begin(), hole.end());
+    }
+    situation.dead = CardSet::full() - kept;
+
+    Evaluator evaluator;
+    std::vector<uint16_t> results(100 * 2);
+    REQUIRE(evaluator.simulate(situation, results.data(), 100) == 100);
+    for (size_t i = 0; i < 100; ++i) {
+      for (size_t p = 0; p < 2; ++p) {
+        REQUIRE(results[i * 2 + p] == eval7(hash, std::array<uint32_t, 7>{
+          situation.hands[p][0], situation.hands[p][1], board[0], board[1], board[2], board[3], board[4]}));
+      }
+    }
+  }
+}
+
+TEST_CASE("range evaluation leaves dead cards out", "[range][dead_cards]") {
+  auto hero = cards("As Ah");
+  auto villain = cards("Kd Kc Qh Jh Ts 9s Ah Kh");
+  auto board = cards("Ks 7h 2h");
+  auto dead = cards("Ts 3c");
+
+  HandRange range;
+  for (size_t i = 0; i < villain.size(); i += 2) {
+    range.addHand(villain[i], villain[i + 1]);
+  }
+
+  RangeEvaluator range_evaluator;
+  range_evaluator.set_board(board.begin(), board.end());
+  range_evaluator.set_dead_cards(dead.begin(), dead.end());
+  auto result = range_evaluator.evaluate({hero[0], hero[1]}, range);
+
+  // Ts 9s holds a dead card, and Ah Kh a card of the hand
+  double win = 0, tie = 0;
+  for (size_t i = 0; i < 4; i += 2) {
+    Evaluator evaluator;
+    std::vector<uint32_t> hands = {hero[0], hero[1], villain[i], villain[i + 1]};
+    evaluator.set_hands(hands.begin(), hands.end());
+    evaluator.set_board(board.begin(), board.end());
+    evaluator.set_dead_cards(dead.begin(), dead.end());
+    auto r = evaluator.evaluate();
+    win += r.win_prob;
+    tie += r.tie_prob;
+  }
+  REQUIRE(result.win_prob == Approx(win / 2).margin(1e-6));
+  REQUIRE(result.tie_prob == Approx(tie / 2).margin(1e-6));
+
+  // The range-vs-range sweep agrees, and gives blocked combos nothing
+  HandRange hero_range;
+  hero_range.addHand(hero[0], hero[1]);
+  hero_range.addHand(dead[0], card_at(0));
+  auto results = range_evaluator.evaluate(hero_range, range);
+  REQUIRE(results[0].win_prob == Approx(result.win_prob).margin(1e-6));
+  REQUIRE(results[1].win_prob == 0.f);
+}
+
+TEST_CASE("hand against random opponents", "[evaluate][vs_random]") {
+  SECTION("one opponent is enumerated exactly") {
+    for (const std::string board_s : {"Kh 7d 2c 9s 9h", "Kh 7d 2c 9s", "Kh 7d 2c"}) {
+      for (const std::string hands_s : {"As Ad", "As Ad Tc 9c"}) {
+        auto situation = make_situation(hands_s, board_s);
+
+        // Average over the opponent's hands, which all leave as many runouts
+        CardSet known = CardSet(situation.board.begin(), situation.board.end());
+        for (const auto& hole : situation.hands) {
+          known |= CardSet(hole.begin(), hole.end());
+        }
+        std::vector<uint32_t> deck;
+        (CardSet::full() - known).for_each([&](uint32_t card) { deck.push_back(card); });
+
+        Evaluator evaluator;
+        double win = 0, tie = 0;
+        size_t opponent_hands = 0;
+        for (size_t j = 1; j < deck.size(); ++j) {
+          for (size_t i = 0; i < j; ++i) {
+            auto with_opponent = situation;
+            with_opponent.hands.push_back({deck[i], deck[j]});
+            auto r = evaluator.evaluate(with_opponent);
+            win += r.win_prob;
+            tie += r.tie_prob;
+            ++opponent_hands;
+          }
+        }
+
+        auto result = evaluator.evaluate_vs_random(situation, 1);
+        REQUIRE(result.win_prob == Approx(win / opponent_hands).margin(1e-5));
+        REQUIRE(result.tie_prob == Approx(tie / opponent_hands).margin(1e-5));
+
+        auto pool = std::make_shared<ThreadPool>(3);
+        Evaluator parallel;
+        parallel.set_thread_pool(pool, 0);
+        auto parallel_result = parallel.evaluate_vs_random(situation, 1);
+        REQUIRE(parallel_result.win_prob == result.win_prob);
+        REQUIRE(parallel_result.tie_prob == result.tie_prob);
+      }
+    }
+  }
+
+  SECTION("Monte Carlo matches exact counts within sampling error") {
+    // Two opponents on the river: rank every hand they can hold once, then
+    // count the disjoint pairs of hands
+    auto situation = make_situation("Qs Qd", "Kh 7d 2c 9s 3h");
+    const auto& b = situation.board;
+    CardSet known = CardSet(b.begin(), b.end()) | CardSet(situation.hands[0].begin(), situation.hands[0].end());
+    std::vector<uint32_t> deck;
+    (CardSet::full() - known).for_each([&](uint32_t card) { deck.push_back(card); });
+
+    auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+    auto rank = [&](uint32_t c1, uint32_t c2) {
+      return eval7(hash, std::array<uint32_t, 7>{c1, c2, b[0], b[1], b[2], b[3], b[4]});
+    };
+    uint16_t hero = rank(situation.hands[0][0], situation.hands[0][1]);
+
+    std::vector<std::pair<CardSet, uint16_t>> hands;
+    for (size_t j = 1; j < deck.size(); ++j) {
+      for (size_t i = 0; i < j; ++i) {
+        std::array<uint32_t, 2> hole = {deck[i], deck[j]};
+        hands.push_back({CardSet(hole.begin(), hole.end()), rank(deck[i], deck[j])});
+      }
+    }
+    uint64_t wins = 0, ties = 0, total = 0;
+    for (const auto& [cards1, rank1] : hands) {
+      for (const auto& [cards2, rank2] : hands) {
+        if (cards1.intersects(cards2)) continue;
+        uint16_t best = std::min(rank1, rank2);
+        wins += hero < best;
+        ties += hero == best;
+        ++total;
+      }
+    }
+
+    Evaluator evaluator;
+    evaluator.set_num_simulations(200000);
+    auto result = evaluator.evaluate_vs_random(situation, 2);
+    REQUIRE(result.win_prob == Approx(static_cast<double>(wins) / total).margin(0.005));
+    REQUIRE(result.tie_prob == Approx(static_cast<double>(ties) / total).margin(0.005));
+
+    // Seeded like `simulate`: repeated queries agree
+    REQUIRE(evaluator.evaluate_vs_random(situation, 2).win_prob == result.win_prob);
+  }
+
+  SECTION("preflop tables agree with sampling") {
+    auto hand_class = [](const std::string& hand_s) {
+      auto hand = cards(hand_s);
+      return starting_hand_class(hand[0], hand[1]);
+    };
+    REQUIRE(hand_class("As Ah") == 0);
+    REQUIRE(hand_class("Kc Ac") == 1);
+    REQUIRE(hand_class("Ad Kh") == 13);
+    REQUIRE(hand_class("2c 2d") == 168);
+
+    Evaluator sampled;
+    sampled.set_preflop_tables(false);
+    sampled.set_num_simulations(200000);
+    Evaluator tabled;
+
+    for (const std::string hand_s : {"As Ah", "Jh Th", "7c 2d"}) {
+      auto situation = make_situation(hand_s, "");
+      for (size_t opponents : {1, 3, 9}) {
+        auto expected = sampled.evaluate_vs_random(situation, opponents);
+        auto result = tabled.evaluate_vs_random(situation, opponents);
+        REQUIRE(result.win_prob == Approx(expected.win_prob).margin(0.006));
+        REQUIRE(result.tie_prob == Approx(expected.tie_prob).margin(0.006));
+      }
+    }
+
+    // Past the tables, and with dead cards, the query is sampled
+    auto situation = make_situation("As Ah", "");
+    REQUIRE(tabled.evaluate_vs_random(situation, 12).win_prob > 0.f);
+    situation.dead.insert(cards("Ad")[0]);
+    REQUIRE(tabled.evaluate_vs_random(situation, 1).win_prob != preflop_vs_random(situation.hands[0][0], situation.hands[0][1], 1)->win_prob);
+  }
+
+  SECTION("the opponents must fit the deck") {
+    Evaluator evaluator;
+    auto situation = make_situation("As Ad", "");
+    REQUIRE_THROWS_AS(evaluator.evaluate_vs_random(situation, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(evaluator.evaluate_vs_random(situation, MAX_PLAYERS), std::invalid_argument);
+    REQUIRE_NOTHROW(evaluator.evaluate_vs_random(situation, MAX_PLAYERS - 1));
+
+    const auto& hole = situation.hands[0];
+    situation.dead = CardSet::full() - CardSet(hole.begin(), hole.end());
+    REQUIRE_THROWS_AS(evaluator.evaluate_vs_random(situation, 1), std::invalid_argument);
+  }
+}
+
+TEST_CASE("hand potential against a range", "[evaluate][potential]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+
+  HandRange range;
+  auto villain = cards("Kd Kc Qh Jh Th 9h 8s 8c As Ks 7h 6h 5c 5d Ad 2d");
+  for (size_t i = 0; i < villain.size(); i += 2) {
+    range.addHand(villain[i], villain[i + 1], i % 4 == 0 ? 1.f : 0.5f);
+  }
+
+  for (const std::string board_s : {"Kh 7d 2c", "Kh 7d 2c 9s", "Kh 7d 2c 9s 3h"}) {
+    auto situation = make_situation("As Qd", board_s);
+    const auto& board = situation.board;
+
+    // Rank of two hole cards with the board and the runout
+    auto rank = [&](uint32_t c1, uint32_t c2, const std::vector<uint32_t>& runout) {
+      std::vector<uint32_t> hand = {c1, c2};
+      hand.insert(hand.end(), board.begin(), board.end());
+      hand.insert(hand.end(), runout.begin(), runout.end());
+      if (hand.size() == 5) return eval5(hash, {hand[0], hand[1], hand[2], hand[3], hand[4]});
+      if (hand.size() == 6) return eval6(hash, {hand[0], hand[1], hand[2], hand[3], hand[4], hand[5]});
+      return eval7(hash, std::array<uint32_t, 7>{hand[0], hand[1], hand[2], hand[3], hand[4], hand[5], hand[6]});
+    };
+    auto standing = [](uint16_t hero, uint16_t other) { return hero < other ? 0 : hero == other ? 1 : 2; };
+
+    const auto& hero = situation.hands[0];
+    CardSet known = CardSet(board.begin(), board.end()) | CardSet(hero.begin(), hero.end());
+    std::vector<uint32_t> deck;
+    (CardSet::full() - known).for_each([&](uint32_t card) { deck.push_back(card); });
+
+    std::vector<std::vector<uint32_t>> runouts;
+    if (board.size() == 3) {
+      for (size_t j = 1; j < deck.size(); ++j) {
+        for (size_t i = 0; i < j; ++i) {
+          runouts.push_back({deck[i], deck[j]});
+        }
+      }
+    } else if (board.size() == 4) {
+      for (uint32_t card : deck) {
+        runouts.push_back({card});
+      }
+    } else {
+      runouts.push_back({});
+    }
+
+    double strength = 0, weight = 0;
+    double transitions[3][3] = {};
+    double ehs = 0, ehs2 = 0;
+    const uint16_t hero_now = rank(hero[0], hero[1], {});
+    for (const auto& [combo, w] : range.hands()) {
+      if (known.contains(combo.first) || known.contains(combo.second)) continue;
+      int now = standing(hero_now, rank(combo.first, combo.second, {}));
+      strength += now == 0 ? w : now == 1 ? w / 2 : 0;
+      weight += w;
+    }
+    for (const auto& runout : runouts) {
+      CardSet dealt(runout.begin(), runout.end());
+      double then[3] = {};
+      uint16_t hero_then = rank(hero[0], hero[1], runout);
+      for (const auto& [combo, w] : range.hands()) {
+        if (known.contains(combo.first) || known.contains(combo.second)) continue;
+        if (dealt.contains(combo.first) || dealt.contains(combo.second)) continue;
+        int now = standing(hero_now, rank(combo.first, combo.second, {}));
+        int later = standing(hero_then, rank(combo.first, combo.second, runout));
+        transitions[now][later] += w;
+        then[later] += w;
+      }
+      double final_strength = (then[0] + then[1] / 2) / (then[0] + then[1] + then[2]);
+      ehs += final_strength;
+      ehs2 += final_strength * final_strength;
+    }
+    auto from = [&](int now) { return transitions[now][0] + transitions[now][1] + transitions[now][2]; };
+    double ppot = (transitions[2][0] + transitions[2][1] / 2 + transitions[1][0] / 2) / (from(2) + from(1) / 2);
+    double npot = (transitions[0][2] + transitions[1][2] / 2 + transitions[0][1] / 2) / (from(0) + from(1) / 2);
+
+    Evaluator evaluator;
+    auto result = evaluator.potential(situation, range);
+    REQUIRE(result.hand_strength == Approx(strength / weight).margin(1e-6));
+    REQUIRE(result.ehs == Approx(ehs / runouts.size()).margin(1e-6));
+    REQUIRE(result.ehs2 == Approx(ehs2 / runouts.size()).margin(1e-6));
+    REQUIRE(result.ppot == Approx(ppot).margin(1e-6));
+    REQUIRE(result.npot == Approx(npot).margin(1e-6));
+    if (board.size() == 5) {
+      REQUIRE(result.ppot == 0.f);
+      REQUIRE(result.npot == 0.f);
+      REQUIRE(result.ehs == result.hand_strength);
+    }
+
+    auto pool = std::make_shared<ThreadPool>(3);
+    Evaluator parallel;
+    parallel.set_thread_pool(pool, 0);
+    auto parallel_result = parallel.potential(situation, range);
+    REQUIRE(parallel_result.ehs == result.ehs);
+    REQUIRE(parallel_result.ehs2 == result.ehs2);
+    REQUIRE(parallel_result.ppot == result.ppot);
+    REQUIRE(parallel_result.npot == result.npot);
+  }
+
+  // A range fully blocked by the known cards leaves nothing to measure
+  HandRange blocked;
+  auto blocked_cards = cards("As Kc Kh Kd");
+  blocked.addHand(blocked_cards[0], blocked_cards[1]);
+  blocked.addHand(blocked_cards[2], blocked_cards[3]);
+  auto result = Evaluator().potential(make_situation("As Qd", "Kh 7d 2c"), blocked);
+  REQUIRE(result.hand_strength == 0.f);
+  REQUIRE(result.ehs == 0.f);
+}
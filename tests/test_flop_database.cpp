@@ -0,0 +1,121 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "card_index.h"
+#include "evaluation.hpp"
+#include "flop_database.hpp"
+#include "rng.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+  // Two two-tone flops (Qs Js 6h and Ks 6h 2s), whose isomorphs take
+  // lookups through non-trivial suit permutations
+  constexpr size_t FIRST_FLOP = 700;
+  constexpr size_t LAST_FLOP = 701;
+
+  // The flop with its suits permuted and in random order
+  std::array<uint32_t, 3> random_isomorph(std::array<uint32_t, 3> flop, Philox4x32& rng) {
+    std::array<int, 4> suits;
+    std::iota(suits.begin(), suits.end(), 0);
+    for (int i = 3; i > 0; --i) {
+      std::swap(suits[i], suits[rng.bounded(i + 1)]);
+    }
+    for (auto& card : flop) {
+      int index = card_index(card);
+      card = card_at(suits[index / 13] * 13 + index % 13);
+    }
+    std::swap(flop[0], flop[rng.bounded(3)]);
+    return flop;
+  }
+}
+
+TEST_CASE("flop database matches enumeration", "[evaluate][flop_database]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_flop_database.bin";
+  std::filesystem::remove(path);
+
+  FlopDatabase::GenerateOptions options;
+  options.first_flop = FIRST_FLOP;
+  options.last_flop = LAST_FLOP;
+  options.num_threads = 2;
+  REQUIRE(FlopDatabase::generate(path.string(), options) == 2);
+
+  // Present flops are not computed again
+  options.first_flop = LAST_FLOP;
+  options.last_flop = LAST_FLOP;
+  REQUIRE(FlopDatabase::generate(path.string(), options) == 0);
+
+  auto database = std::make_shared<const FlopDatabase>(FlopDatabase::load(path.string()));
+  REQUIRE(database->size() == 2);
+  REQUIRE(database->contains(FIRST_FLOP));
+  REQUIRE_FALSE(database->contains(0));
+
+  Evaluator evaluator;
+  Evaluator with_database;
+  with_database.set_flop_database(database);
+
+  Philox4x32 rng(43);
+  for (int i = 0; i < 300; ++i) {
+    auto flop = random_isomorph(FlopDatabase::canonical_flop(FIRST_FLOP + i % 2), rng);
+
+    std::array<uint32_t, 4> hole{};
+    for (size_t n = 0; n < hole.size(); ++n) {
+      uint32_t card;
+      do {
+        card = card_at(rng.bounded(52));
+      } while (std::find(flop.begin(), flop.end(), card) != flop.end() ||
+               std::find(hole.begin(), hole.begin() + n, card) != hole.begin() + n);
+      hole[n] = card;
+    }
+
+    Situation situation;
+    situation.hands = {{hole[0], hole[1]}, {hole[2], hole[3]}};
+    situation.board = {flop[0], flop[1], flop[2]};
+
+    auto looked_up = database->lookup({hole[0], hole[1]}, {hole[2], hole[3]}, flop);
+    REQUIRE(looked_up);
+
+    auto expected = evaluator.evaluate(situation);
+    REQUIRE(looked_up->win_prob == expected.win_prob);
+    REQUIRE(looked_up->tie_prob == expected.tie_prob);
+
+    auto result = with_database.evaluate(situation);
+    REQUIRE(result.win_prob == expected.win_prob);
+    REQUIRE(result.tie_prob == expected.tie_prob);
+  }
+
+  // Flops that were not generated are left to enumeration
+  auto missing = FlopDatabase::canonical_flop(0);
+  std::array<uint32_t, 2> hero = {card_at(51), card_at(50)};
+  std::array<uint32_t, 2> villain = {card_at(49), card_at(48)};
+  REQUIRE_FALSE(database->lookup(hero, villain, missing));
+
+  Situation situation;
+  situation.hands = {hero, villain};
+  situation.board = {missing[0], missing[1], missing[2]};
+  auto expected = evaluator.evaluate(situation);
+  REQUIRE(with_database.evaluate(situation).win_prob == expected.win_prob);
+
+  database.reset();
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("flop database rejects invalid files", "[flop_database]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_not_a_flop_database.bin";
+  std::filesystem::remove(path);
+
+  REQUIRE_THROWS_AS(FlopDatabase::load(path.string()), std::runtime_error);
+
+  FlopDatabase::GenerateOptions options;
+  options.first_flop = 3;
+  options.last_flop = 2;
+  REQUIRE_THROWS_AS(FlopDatabase::generate(path.string(), options), std::invalid_argument);
+}
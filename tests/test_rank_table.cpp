@@ -0,0 +1,101 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "eval.h"
+#include "bitset_rankindex.h"
+#include "card_index.h"
+#include "combinations.h"
+#include "rank_table.hpp"
+#include "rng.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+  std::array<CardIndex, 7> random_hand(size_t num_cards, Philox4x32& rng) {
+    std::array<CardIndex, 7> hand{};
+    uint64_t used = 0;
+    for (auto& card : hand) {
+      do {
+        card = static_cast<CardIndex>(rng.bounded(static_cast<uint32_t>(num_cards)));
+      } while ((used >> card) & 1);
+      used |= uint64_t(1) << card;
+    }
+    return hand;
+  }
+}
+
+TEST_CASE("rank table index is the colex rank", "[rank_table]") {
+  Philox4x32 rng(50);
+  for (int i = 0; i < 10000; ++i) {
+    auto hand = random_hand(52, rng);
+    auto sorted = hand;
+    std::sort(sorted.begin(), sorted.end());
+    REQUIRE(RankTable::index(hand) == Combinations<7>::rank(sorted));
+  }
+
+  REQUIRE(RankTable::index({0, 1, 2, 3, 4, 5, 6}) == 0);
+  REQUIRE(RankTable::index({45, 46, 47, 48, 49, 50, 51}) == RankTable::NUM_HANDS - 1);
+}
+
+TEST_CASE("rank table ranks match eval7", "[rank_table]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_rank_table.bin";
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+
+  // Two suits and a half: every category but four of a kind
+  RankTable::GenerateOptions options;
+  options.num_cards = 32;
+  options.num_threads = 2;
+  uint64_t reported = 0;
+  options.progress = [&](uint64_t done, uint64_t total) {
+    REQUIRE(done > reported);
+    REQUIRE(total == binomial(32, 7));
+    reported = done;
+  };
+  RankTable::generate(path.string(), options);
+  REQUIRE(reported == binomial(32, 7));
+
+  auto table = RankTable::load(path.string());
+  std::filesystem::remove(path);
+  REQUIRE(table.num_cards() == 32);
+  REQUIRE(table.size() == binomial(32, 7));
+
+  for (uint64_t index = 0; index < table.size(); index += 997) {
+    REQUIRE(table.at(index) == eval7(hash, Combinations<7>::unrank(index)));
+  }
+
+  Philox4x32 rng(7);
+  for (int i = 0; i < 20000; ++i) {
+    auto hand = random_hand(32, rng);
+    REQUIRE(table.eval7(hand) == eval7(hash, hand));
+    REQUIRE(table(to_cards(hand)) == eval7(hash, hand));
+  }
+
+  // Moving keeps the mapping
+  RankTable moved = std::move(table);
+  REQUIRE(moved.size() == binomial(32, 7));
+  REQUIRE(moved.at(0) == eval7(hash, Combinations<7>::unrank(0)));
+}
+
+TEST_CASE("rank table rejects invalid input", "[rank_table]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_not_a_rank_table.bin";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << std::string(8192, 'x');
+  }
+  REQUIRE_THROWS_AS(RankTable::load(path.string()), std::runtime_error);
+  std::filesystem::remove(path);
+  REQUIRE_THROWS_AS(RankTable::load(path.string()), std::runtime_error);
+
+  RankTable::GenerateOptions options;
+  options.num_cards = 6;
+  REQUIRE_THROWS_AS(RankTable::generate(path.string(), options), std::invalid_argument);
+  options.num_cards = 53;
+  REQUIRE_THROWS_AS(RankTable::generate(path.string(), options), std::invalid_argument);
+}
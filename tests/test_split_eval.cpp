@@ -0,0 +1,53 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "utils.h"
+#include "eval.h"
+#include "bitset_rankindex.h"
+#include "card_index.h"
+#include "rng.h"
+#include "split_eval.h"
+
+TEST_CASE("split suit/rank evaluation matches eval7", "[evaluate][split_eval]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  const auto& split = split_evaluator();
+
+  SECTION("random hands") {
+    Philox4x32 rng(33);
+    for (int i = 0; i < 200000; ++i) {
+      std::array<uint32_t, 7> hand{};
+      uint64_t used = 0;
+      for (auto& card : hand) {
+        int index;
+        do {
+          index = rng.bounded(52);
+        } while ((used >> index) & 1);
+        used |= uint64_t(1) << index;
+        card = card_at(index);
+      }
+      REQUIRE(split.eval7(hand) == eval7(hash, hand));
+    }
+  }
+
+  SECTION("every flush of 5 to 7 cards") {
+    for (uint32_t mask = 0; mask < 8192; ++mask) {
+      int bits = std::popcount(mask);
+      if (bits < 5 || bits > 7) continue;
+
+      // Hearts of the mask, filled up with spades and clubs
+      std::array<uint32_t, 7> hand{};
+      size_t n = 0;
+      for (int rank = 0; rank < 13; ++rank) {
+        if (mask & (1u << rank)) hand[n++] = card_at(13 + rank);
+      }
+      for (int rank = 0; n < 7; ++rank, ++n) {
+        hand[n] = card_at((rank % 2 ? 0 : 39) + rank);
+      }
+      REQUIRE(split.eval7(hand) == eval7(hash, hand));
+    }
+  }
+}
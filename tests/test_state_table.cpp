@@ -0,0 +1,95 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "types.h"
+#include "utils.h"
+#include "eval.h"
+#include "bitset_rankindex.h"
+#include "card_index.h"
+#include "evaluation.hpp"
+#include "rng.h"
+#include "state_table.hpp"
+
+#include <filesystem>
+#include <memory>
+
+namespace {
+  // Building takes a few seconds, share one table between test cases
+  std::shared_ptr<const StateTable> state_table() {
+    static auto table = std::make_shared<const StateTable>(StateTable::build());
+    return table;
+  }
+
+  std::array<CardIndex, 7> random_hand(Philox4x32& rng) {
+    std::array<CardIndex, 7> hand{};
+    uint64_t used = 0;
+    for (auto& card : hand) {
+      do {
+        card = static_cast<CardIndex>(rng.bounded(52));
+      } while ((used >> card) & 1);
+      used |= uint64_t(1) << card;
+    }
+    return hand;
+  }
+}
+
+TEST_CASE("state table ranks match eval7", "[evaluate][state_table]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  const auto& table = *state_table();
+
+  Philox4x32 rng(2024);
+  for (int i = 0; i < 200000; ++i) {
+    auto hand = random_hand(rng);
+    REQUIRE(table.eval7(hand) == eval7(hash, hand));
+    REQUIRE(table(to_cards(hand)) == eval7(hash, hand));
+  }
+}
+
+TEST_CASE("state table survives a save and memory-mapped load", "[state_table]") {
+  auto path = std::filesystem::temp_directory_path() / "poker_eval_state_table.bin";
+  state_table()->save(path.string());
+  auto loaded = StateTable::load(path.string());
+  std::filesystem::remove(path);
+
+  REQUIRE(loaded.num_states() == state_table()->num_states());
+
+  Philox4x32 rng(7);
+  for (int i = 0; i < 10000; ++i) {
+    auto hand = random_hand(rng);
+    REQUIRE(loaded.eval7(hand) == state_table()->eval7(hand));
+  }
+
+  REQUIRE_THROWS_AS(StateTable::load(path.string()), std::runtime_error);
+}
+
+TEST_CASE("evaluator backends agree", "[evaluate][state_table]") {
+  Evaluator compact;
+  Evaluator table_driven;
+  table_driven.set_state_table(state_table());
+
+  for (auto board : {"", "Ts 9h 8d", "Ts 9h 8d 2c"}) {
+    std::vector<uint32_t> hands = {
+      card_from_rank_suit(14, SPADES), card_from_rank_suit(13, HEARTS),
+      card_from_rank_suit(12, DIAMONDS), card_from_rank_suit(11, CLUBS)
+    };
+    std::vector<uint32_t> board_cards;
+    for (const char* c = board; *c; c += (c[2] ? 3 : 2)) {
+      char card_s[3] = {c[0], c[1], '\0'};
+      board_cards.push_back(card_from_string(card_s));
+    }
+
+    for (auto* evaluator : {&compact, &table_driven}) {
+      evaluator->set_num_simulations(5000);
+      evaluator->set_hands(hands.begin(), hands.end());
+      evaluator->set_board(board_cards.begin(), board_cards.end());
+    }
+
+    auto expected = compact.evaluate();
+    auto actual = table_driven.evaluate();
+    REQUIRE(actual.win_prob == expected.win_prob);
+    REQUIRE(actual.tie_prob == expected.tie_prob);
+  }
+}
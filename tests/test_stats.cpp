@@ -0,0 +1,64 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "stats.h"
+#include "utils.h"
+#include "eval.h"
+#include "evaluation.hpp"
+#include "bitset_rankindex.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+  uint32_t card(const std::string& card_s) {
+    char card_str[3] = {card_s[0], card_s[1], '\0'};
+    return card_from_string(card_str);
+  }
+}
+
+TEST_CASE("stats count the lookup path of each 5-card hand", "[stats]") {
+  auto hash = BitsetRankIndex(MAX_HASH_KEY, KEYS);
+  reset_eval_stats();
+
+  eval5(hash, {card("As"), card("Ks"), card("9s"), card("5s"), card("2s")});
+  eval5(hash, {card("As"), card("Kh"), card("9s"), card("5s"), card("2s")});
+  eval5(hash, {card("As"), card("Ah"), card("9s"), card("5s"), card("2s")});
+  auto stats = eval_stats();
+
+  if constexpr (eval_stats_enabled) {
+    REQUIRE(stats.eval5_calls == 3);
+    REQUIRE(stats.flush_hits == 1);
+    REQUIRE(stats.unique5_hits == 1);
+    REQUIRE(stats.hash_hits == 1);
+  } else {
+    REQUIRE(stats.eval5_calls == 0);
+  }
+}
+
+TEST_CASE("stats count simulations and hands ranked by a query", "[stats]") {
+  std::vector<uint32_t> hands = {card("As"), card("Ah"), card("Kd"), card("Kc")};
+  std::vector<uint32_t> board = {card("2c"), card("7d"), card("Kh"), card("9s")};
+
+  Evaluator evaluator;
+  evaluator.set_hands(hands.begin(), hands.end());
+  evaluator.set_board(board.begin(), board.end());
+
+  reset_eval_stats();
+  evaluator.evaluate();
+  auto stats = eval_stats();
+
+  if constexpr (eval_stats_enabled) {
+    REQUIRE(stats.simulations == 44);
+    REQUIRE(stats.eval7_calls == 88);
+    REQUIRE(stats.deck_rebuilds == 1);
+    REQUIRE(stats.simulate_seconds > 0.);
+  } else {
+    REQUIRE(stats.simulations == 0);
+    REQUIRE(stats.eval7_calls == 0);
+  }
+}
@@ -0,0 +1,63 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "bitset_rankindex.h"
+#include "rng.h"
+#include "table_buffer.h"
+#include "tables.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("interleaved eval5 table matches flush_table and unique5", "[tables]") {
+  REQUIRE(reinterpret_cast<uintptr_t>(eval5_table.data()) % 64 == 0);
+  for (size_t i = 0; i < eval5_table.size(); ++i) {
+    REQUIRE(eval5_table[i].flush == flush_table[i]);
+    REQUIRE(eval5_table[i].unique == unique5[i]);
+  }
+}
+
+TEST_CASE("table buffers are zeroed and aligned", "[tables]") {
+  for (size_t bytes : {size_t(1), size_t(4096), TableBuffer::HUGE_PAGE_SIZE + 1, 3 * TableBuffer::HUGE_PAGE_SIZE}) {
+    TableBuffer buffer(bytes);
+    REQUIRE(buffer.size() == bytes);
+    REQUIRE(reinterpret_cast<uintptr_t>(buffer.as<char>()) % TableBuffer::ALIGNMENT == 0);
+    const char* data = buffer.as<char>();
+    REQUIRE(std::all_of(data, data + bytes, [](char c) { return c == 0; }));
+
+    TableBuffer moved = std::move(buffer);
+    REQUIRE(moved.as<char>() == data);
+    REQUIRE(buffer.as<char>() == nullptr);
+  }
+}
+
+TEST_CASE("rank index ranks keys in increasing order", "[tables]") {
+  BitsetRankIndex hash(MAX_HASH_KEY, KEYS);
+  REQUIRE(hash.size() == KEYS.size());
+  for (size_t i = 0; i < KEYS.size(); ++i) {
+    REQUIRE(hash.contains(KEYS[i]));
+    REQUIRE(hash(KEYS[i]) == i);
+  }
+  REQUIRE_FALSE(hash.contains(KEYS[0] + 1));
+  REQUIRE_FALSE(hash.contains(MAX_HASH_KEY + 64));
+
+  // Keys at the edges of the bitset words
+  Philox4x32 rng(5);
+  std::vector<uint32_t> keys = {0, 63, 64, 127, 128, 1000};
+  for (int i = 0; i < 1000; ++i) {
+    keys.push_back(rng.bounded(100000));
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  BitsetRankIndex index(100000, keys);
+  REQUIRE(index.size() == keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    REQUIRE(index(keys[i]) == i);
+  }
+}
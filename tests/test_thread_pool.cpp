@@ -0,0 +1,114 @@
+#if __has_include(<catch2/catch_all.hpp>)
+  #include <catch2/catch_all.hpp>
+#else
+  #include <catch2/catch.hpp>
+#endif
+
+#include "card_index.h"
+#include "evaluation.hpp"
+#include "rng.h"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("thread pool runs every index once", "[thread_pool]") {
+  ThreadPool pool(4);
+  REQUIRE(pool.num_threads() == 4);
+
+  for (size_t n : {0, 1, 7, 990, 10000}) {
+    for (size_t grain : {1, 3, 64}) {
+      // Assertions are only made on the calling thread
+      std::vector<std::atomic<int>> calls(n);
+      std::atomic<size_t> largest{0};
+      pool.parallel_for(n, grain, [&](size_t begin, size_t end) {
+        size_t size = end - begin;
+        size_t seen = largest;
+        while (size > seen && !largest.compare_exchange_weak(seen, size)) {}
+        for (size_t i = begin; i < end; ++i) {
+          ++calls[i];
+        }
+      });
+      REQUIRE(largest <= grain);
+      for (const auto& count : calls) {
+        REQUIRE(count == 1);
+      }
+    }
+  }
+
+  SECTION("nested loops run on the calling thread") {
+    std::atomic<size_t> total{0};
+    std::atomic<size_t> elsewhere{0};
+    pool.parallel_for(8, 1, [&](size_t, size_t) {
+      auto outer = std::this_thread::get_id();
+      pool.parallel_for(100, 10, [&](size_t begin, size_t end) {
+        total += end - begin;
+        elsewhere += std::this_thread::get_id() != outer;
+      });
+    });
+    REQUIRE(total == 800);
+    REQUIRE(elsewhere == 0);
+  }
+
+  SECTION("exceptions reach the caller") {
+    std::atomic<size_t> done{0};
+    REQUIRE_THROWS_AS(pool.parallel_for(100, 1, [&](size_t begin, size_t) {
+      if (begin == 42) {
+        throw std::runtime_error("chunk failed");
+      }
+      ++done;
+    }), std::runtime_error);
+    REQUIRE(done == 99);
+
+    // The pool is still usable
+    std::atomic<size_t> total{0};
+    pool.parallel_for(100, 1, [&](size_t begin, size_t end) { total += end - begin; });
+    REQUIRE(total == 100);
+  }
+}
+
+TEST_CASE("parallel enumeration matches the serial one", "[evaluate][thread_pool]") {
+  auto pool = std::make_shared<ThreadPool>(3);
+  Evaluator serial;
+  Evaluator parallel;
+  parallel.set_thread_pool(pool, 0);
+
+  Philox4x32 rng(44);
+  std::vector<uint16_t> expected(990 * 4);
+  std::vector<uint16_t> results(990 * 4);
+
+  for (int i = 0; i < 100; ++i) {
+    size_t num_players = 2 + i % 3;
+    size_t board_size = i % 2 ? 3 : 4;
+
+    uint64_t used = 0;
+    auto deal = [&] {
+      int index;
+      do {
+        index = rng.bounded(52);
+      } while ((used >> index) & 1);
+      used |= uint64_t(1) << index;
+      return card_at(index);
+    };
+
+    Situation situation;
+    for (size_t p = 0; p < num_players; ++p) {
+      situation.hands.push_back({deal(), deal()});
+    }
+    for (size_t c = 0; c < board_size; ++c) {
+      situation.board.push_back(deal());
+    }
+
+    size_t rows = serial.simulate(situation, expected.data(), 0);
+    REQUIRE(parallel.simulate(situation, results.data(), 0) == rows);
+    REQUIRE(std::equal(expected.begin(), expected.begin() + rows * num_players, results.begin()));
+
+    auto serial_result = serial.evaluate(situation);
+    auto parallel_result = parallel.evaluate(situation);
+    REQUIRE(parallel_result.win_prob == serial_result.win_prob);
+    REQUIRE(parallel_result.tie_prob == serial_result.tie_prob);
+  }
+}